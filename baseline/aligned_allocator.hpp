@@ -0,0 +1,26 @@
+#ifndef ALIGNED_ALLOCATOR_HPP
+#define ALIGNED_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <new>
+
+// std::vector allocator whose buffer starts on an Align-byte boundary (Align: power of two);
+// used by the array heaps that lay their elements out in cache-line / page sized groups
+template <typename T, std::size_t Align>
+struct AlignedAllocator {
+    static_assert((Align & (Align - 1)) == 0, "AlignedAllocator: Align must be a power of two");
+
+    using value_type = T;
+    template <typename U> struct rebind { using other = AlignedAllocator<U, Align>; };
+
+    AlignedAllocator() = default;
+    template <typename U> AlignedAllocator(const AlignedAllocator<U, Align>&) {}
+
+    T *allocate(std::size_t n) { return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Align))); }
+    void deallocate(T *p, std::size_t) { ::operator delete(p, std::align_val_t(Align)); }
+
+    template <typename U> bool operator==(const AlignedAllocator<U, Align>&) const { return true; }
+    template <typename U> bool operator!=(const AlignedAllocator<U, Align>&) const { return false; }
+};
+
+#endif
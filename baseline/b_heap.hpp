@@ -0,0 +1,83 @@
+#ifndef B_HEAP_HPP
+#define B_HEAP_HPP
+
+#include <vector>
+#include <stdexcept>
+#include <cstddef>
+#include <utility>
+
+#include "aligned_allocator.hpp"
+
+// min-heap with a blocked (B-heap style) implicit layout: the binary tree is cut into complete
+// subtrees of LEVELS levels, each stored in one block of SLOTS = 2^LEVELS slots (the last slot of
+// a block is padding); a leaf of a block has its two children at the roots of two child blocks.
+// A sift moves LEVELS levels per block, so it crosses ~log2(n) / LEVELS blocks instead of one
+// cache line (or page) per level as in BinaryHeap.
+//   BlockBytes = 64:   one cache line per block
+//   BlockBytes = 4096: one page per block (default)
+// Blocks are filled in index order, so the block tree is a complete SLOTS-ary tree and the
+// height stays <= log2(n) + LEVELS. T must be default constructible (padding slots).
+template <typename T, std::size_t BlockBytes = 4096>
+class BHeap {
+    static constexpr std::size_t floorLog2(std::size_t x) {
+        std::size_t k = 0;
+        while (x >>= 1) k++;
+        return k;
+    }
+
+public:
+    // levels per block (at least 2, so a block always holds more than one node)
+    static constexpr std::size_t LEVELS = floorLog2(BlockBytes / sizeof(T)) > 2 ? floorLog2(BlockBytes / sizeof(T)) : 2;
+    static constexpr std::size_t SLOTS = std::size_t(1) << LEVELS;
+    static constexpr std::size_t NODES = SLOTS - 1;
+    static constexpr std::size_t FIRST_LEAF = SLOTS / 2 - 1; // local index of the first leaf
+
+private:
+    // blocks start on a multiple of their own size (when that is a power of two)
+    static constexpr std::size_t BLOCK_BYTES = SLOTS * sizeof(T);
+    static constexpr std::size_t ALIGN = (BLOCK_BYTES & (BLOCK_BYTES - 1)) == 0 ? BLOCK_BYTES : alignof(T);
+
+    // slot b * SLOTS + j = node j (BFS order inside the block) of block b
+    // data.size() = slot of the last element + 1 (no trailing padding)
+    std::vector<T, AlignedAllocator<T, ALIGN>> data;
+    std::size_t count = 0;
+
+    // slot of the i-th element in fill order
+    static std::size_t slotOf(std::size_t i) { return i / NODES * SLOTS + i % NODES; }
+
+    static std::size_t parentOf(std::size_t slot);
+
+    // Percolate Up / Sift Up (hole-based)
+    void siftUp(std::size_t slot);
+
+    // Percolate Down / Sift Down (hole-based, iterative)
+    void siftDown(std::size_t slot);
+
+public:
+    BHeap() = default;
+    ~BHeap() = default;
+
+    bool empty() const;
+    std::size_t size() const;
+
+    const T& top() const;
+
+    void push(const T& value);
+    void push(T&& value);
+
+    // construct the new element in place at the back, then sift it up
+    template <typename... Args>
+    void emplace(Args&&... args);
+
+    void pop();
+
+    // pop and return the top element (moved out, no copy)
+    T deleteMin();
+
+    void clear();
+};
+
+
+#include "b_heap.ipp"
+
+#endif
@@ -0,0 +1,149 @@
+// Parent - block root goes up to a leaf of the parent block
+template <typename T, std::size_t BlockBytes>
+std::size_t BHeap<T, BlockBytes>::parentOf(std::size_t slot) {
+    std::size_t block = slot >> LEVELS;
+    std::size_t local = slot & (SLOTS - 1);
+
+    if (local > 0) return block * SLOTS + (local - 1) / 2;
+
+    // child block c of block p is p * SLOTS + 1 + c, leaf l owns child blocks 2l and 2l + 1
+    std::size_t c = (block - 1) & (SLOTS - 1);
+    std::size_t parentBlock = (block - 1) >> LEVELS;
+    return parentBlock * SLOTS + FIRST_LEAF + (c >> 1);
+}
+
+// Sift Up - Push
+template <typename T, std::size_t BlockBytes>
+void BHeap<T, BlockBytes>::siftUp(std::size_t slot) {
+    T moving = std::move(data[slot]);
+
+    while (slot > 0) {
+        std::size_t parent = parentOf(slot);
+
+        if (moving < data[parent]) {
+            data[slot] = std::move(data[parent]);
+            slot = parent;
+        } else {
+            break;
+        }
+    }
+
+    data[slot] = std::move(moving);
+}
+
+// Sift Down - Pop
+template <typename T, std::size_t BlockBytes>
+void BHeap<T, BlockBytes>::siftDown(std::size_t slot) {
+    const std::size_t n = data.size();
+    T moving = std::move(data[slot]);
+
+    while (true) {
+        std::size_t local = slot & (SLOTS - 1);
+        std::size_t first, second;
+
+        if (local < FIRST_LEAF) {
+            // both children in the same block, next to each other
+            first = slot + local + 1;
+            second = first + 1;
+        } else {
+            // roots of the two child blocks of this leaf
+            first = ((slot >> LEVELS) * SLOTS + 1 + 2 * (local - FIRST_LEAF)) * SLOTS;
+            second = first + SLOTS;
+        }
+        if (first >= n) break;
+
+        // smaller child (child slots are never padding)
+        std::size_t smallest = first;
+        if (second < n && data[second] < data[first]) {
+            smallest = second;
+        }
+
+        if (data[smallest] < moving) {
+            data[slot] = std::move(data[smallest]);
+            slot = smallest;
+        } else {
+            break;
+        }
+    }
+
+    data[slot] = std::move(moving);
+}
+
+template <typename T, std::size_t BlockBytes>
+bool BHeap<T, BlockBytes>::empty() const {
+    return count == 0;
+}
+
+template <typename T, std::size_t BlockBytes>
+std::size_t BHeap<T, BlockBytes>::size() const {
+    return count;
+}
+
+template <typename T, std::size_t BlockBytes>
+const T& BHeap<T, BlockBytes>::top() const {
+    if (empty()) {
+        throw std::runtime_error("BHeap::top(): empty heap");
+    }
+    return data[0];
+}
+
+template <typename T, std::size_t BlockBytes>
+void BHeap<T, BlockBytes>::push(const T& value) {
+    emplace(value);
+}
+
+template <typename T, std::size_t BlockBytes>
+void BHeap<T, BlockBytes>::push(T&& value) {
+    emplace(std::move(value));
+}
+
+template <typename T, std::size_t BlockBytes>
+template <typename... Args>
+void BHeap<T, BlockBytes>::emplace(Args&&... args) {
+    std::size_t slot = slotOf(count);
+    if (slot > data.size()) {
+        data.emplace_back(); // padding slot at the end of the previous block
+    }
+    data.emplace_back(std::forward<Args>(args)...);
+    count++;
+    siftUp(slot);
+}
+
+template <typename T, std::size_t BlockBytes>
+void BHeap<T, BlockBytes>::pop() {
+    if (empty()) {
+        throw std::runtime_error("BHeap::pop(): heap is empty");
+    }
+
+    if (count > 1) {
+        data[0] = std::move(data.back());
+    }
+    data.pop_back();
+    count--;
+
+    // never leave padding at the back
+    if (!data.empty() && (data.size() & (SLOTS - 1)) == 0) {
+        data.pop_back();
+    }
+
+    if (!empty()) {
+        siftDown(0);
+    }
+}
+
+template <typename T, std::size_t BlockBytes>
+T BHeap<T, BlockBytes>::deleteMin() {
+    if (empty()) {
+        throw std::runtime_error("BHeap::deleteMin(): heap is empty");
+    }
+
+    T result = std::move(data[0]);
+    pop();
+    return result;
+}
+
+template <typename T, std::size_t BlockBytes>
+void BHeap<T, BlockBytes>::clear() {
+    data.clear();
+    count = 0;
+}
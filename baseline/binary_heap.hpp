@@ -4,6 +4,7 @@
 #include <vector>
 #include <stdexcept>
 #include <iostream>
+#include <utility>
 
 template <typename T>
 class BinaryHeap {
@@ -17,8 +18,15 @@ private:
     // Percolate Down / Sift Down
     void siftDown(int index);
 
+    // Floyd heapify: siftDown every internal node bottom-up, O(n)
+    void heapify();
+
 public:
     BinaryHeap() = default;
+
+    // bulk build from [first, last) with Floyd heapify
+    template <typename InputIt>
+    BinaryHeap(InputIt first, InputIt last) : data(first, last) { heapify(); }
     ~BinaryHeap() = default;
 
     bool empty() const;
@@ -27,9 +35,22 @@ public:
     const T& top() const;
 
     void push(const T& value);
+    void push(T&& value);
+
+    // construct the new element in place at the back, then sift it up
+    template <typename... Args>
+    void emplace(Args&&... args);
+
+    // batched push: re-heapify everything when the batch is at least as big as the heap,
+    // otherwise sift each new element up
+    template <typename InputIt>
+    void insertBatch(InputIt first, InputIt last);
 
     void pop();
 
+    // pop and return the top element (moved out, no copy)
+    T deleteMin();
+
     void clear();
 };
 
@@ -38,6 +38,14 @@ void BinaryHeap<T>::siftDown(int index) {
     }
 }
 
+// 3. Heapify - bulk build
+template <typename T>
+void BinaryHeap<T>::heapify() {
+    for (int index = (int)data.size() / 2 - 1; index >= 0; index--) {
+        siftDown(index);
+    }
+}
+
 template <typename T>
 bool BinaryHeap<T>::empty() const {
     return data.empty();
@@ -62,13 +70,44 @@ void BinaryHeap<T>::push(const T& value) {
     siftUp(data.size() - 1);
 }
 
+template <typename T>
+void BinaryHeap<T>::push(T&& value) {
+    data.push_back(std::move(value));
+    siftUp(data.size() - 1);
+}
+
+template <typename T>
+template <typename... Args>
+void BinaryHeap<T>::emplace(Args&&... args) {
+    data.emplace_back(std::forward<Args>(args)...);
+    siftUp(data.size() - 1);
+}
+
+template <typename T>
+template <typename InputIt>
+void BinaryHeap<T>::insertBatch(InputIt first, InputIt last) {
+    size_t oldSize = data.size();
+    data.insert(data.end(), first, last);
+
+    size_t added = data.size() - oldSize;
+    if (added >= oldSize) {
+        heapify();
+    } else {
+        for (size_t i = oldSize; i < data.size(); i++) {
+            siftUp(i);
+        }
+    }
+}
+
 template <typename T>
 void BinaryHeap<T>::pop() {
     if (empty()) {
         throw std::runtime_error("BinaryHeap::pop(): heap is empty");
     }
     
-    data[0] = data.back();
+    if (data.size() > 1) {
+        data[0] = std::move(data.back());
+    }
     data.pop_back();
     
     if (!empty()) {
@@ -76,6 +115,17 @@ void BinaryHeap<T>::pop() {
     }
 }
 
+template <typename T>
+T BinaryHeap<T>::deleteMin() {
+    if (empty()) {
+        throw std::runtime_error("BinaryHeap::deleteMin(): heap is empty");
+    }
+
+    T result = std::move(data[0]);
+    pop();
+    return result;
+}
+
 template <typename T>
 void BinaryHeap<T>::clear() {
     data.clear();
@@ -0,0 +1,61 @@
+#ifndef DARY_HEAP_HPP
+#define DARY_HEAP_HPP
+
+#include <vector>
+#include <stdexcept>
+#include <cstddef>
+#include <utility>
+
+// addressable min-d-ary heap: push returns a handle for decreaseKey
+template <typename T, int D = 4>
+class DaryHeap {
+    static_assert(D >= 2, "DaryHeap: D must be >= 2");
+
+public:
+    using Handle = std::size_t;
+    static constexpr Handle NIL = static_cast<Handle>(-1);
+
+private:
+    struct Entry {
+        T value;
+        Handle id;
+    };
+
+    // vector base
+    std::vector<Entry> data;
+
+    // position map: pos[id] = index of the entry in data (NIL once popped)
+    std::vector<std::size_t> pos;
+
+    // ids of popped entries, reused by push
+    std::vector<Handle> freeIds;
+
+    // Percolate Up / Sift Up (hole-based, no swap)
+    void siftUp(std::size_t index);
+
+    // Percolate Down / Sift Down (hole-based, iterative)
+    void siftDown(std::size_t index);
+
+public:
+    DaryHeap() = default;
+    ~DaryHeap() = default;
+
+    bool empty() const;
+    std::size_t size() const;
+
+    const T& top() const;
+
+    Handle push(const T& value);
+
+    void pop();
+
+    // newValue must not be greater than the current value
+    void decreaseKey(Handle handle, const T& newValue);
+
+    void clear();
+};
+
+
+#include "dary_heap.ipp"
+
+#endif
@@ -0,0 +1,128 @@
+// Sift Up - Push / DecreaseKey
+template <typename T, int D>
+void DaryHeap<T, D>::siftUp(std::size_t index) {
+    Entry moving = std::move(data[index]);
+
+    while (index > 0) {
+        std::size_t parent = (index - 1) / D;
+
+        if (moving.value < data[parent].value) {
+            data[index] = std::move(data[parent]);
+            pos[data[index].id] = index;
+            index = parent;
+        } else {
+            break;
+        }
+    }
+
+    pos[moving.id] = index;
+    data[index] = std::move(moving);
+}
+
+// Sift Down - Pop
+template <typename T, int D>
+void DaryHeap<T, D>::siftDown(std::size_t index) {
+    const std::size_t n = data.size();
+    Entry moving = std::move(data[index]);
+
+    while (true) {
+        std::size_t first = D * index + 1;
+        if (first >= n) break;
+
+        std::size_t last = (first + D < n) ? first + D : n;
+
+        // smallest child
+        std::size_t smallest = first;
+        for (std::size_t c = first + 1; c < last; c++) {
+            if (data[c].value < data[smallest].value) {
+                smallest = c;
+            }
+        }
+
+        if (data[smallest].value < moving.value) {
+            data[index] = std::move(data[smallest]);
+            pos[data[index].id] = index;
+            index = smallest;
+        } else {
+            break;
+        }
+    }
+
+    pos[moving.id] = index;
+    data[index] = std::move(moving);
+}
+
+template <typename T, int D>
+bool DaryHeap<T, D>::empty() const {
+    return data.empty();
+}
+
+template <typename T, int D>
+std::size_t DaryHeap<T, D>::size() const {
+    return data.size();
+}
+
+template <typename T, int D>
+const T& DaryHeap<T, D>::top() const {
+    if (empty()) {
+        throw std::runtime_error("DaryHeap::top(): empty heap");
+    }
+    return data[0].value;
+}
+
+template <typename T, int D>
+typename DaryHeap<T, D>::Handle DaryHeap<T, D>::push(const T& value) {
+    Handle id;
+    if (!freeIds.empty()) {
+        id = freeIds.back();
+        freeIds.pop_back();
+    } else {
+        id = pos.size();
+        pos.push_back(NIL);
+    }
+
+    data.push_back({value, id});
+    siftUp(data.size() - 1);
+    return id;
+}
+
+template <typename T, int D>
+void DaryHeap<T, D>::pop() {
+    if (empty()) {
+        throw std::runtime_error("DaryHeap::pop(): heap is empty");
+    }
+
+    Handle id = data[0].id;
+    pos[id] = NIL;
+    freeIds.push_back(id);
+
+    if (data.size() > 1) {
+        data[0] = std::move(data.back());
+        data.pop_back();
+        siftDown(0);
+    } else {
+        data.pop_back();
+    }
+}
+
+template <typename T, int D>
+void DaryHeap<T, D>::decreaseKey(Handle handle, const T& newValue) {
+    if (handle >= pos.size() || pos[handle] == NIL) {
+        throw std::runtime_error("DaryHeap::decreaseKey: invalid handle");
+    }
+
+    std::size_t index = pos[handle];
+    if (data[index].value < newValue) {
+        throw std::runtime_error("DaryHeap::decreaseKey: newValue must be <= current value");
+    }
+
+    data[index].value = newValue;
+    siftUp(index);
+}
+
+template <typename T, int D>
+void DaryHeap<T, D>::clear() {
+    data.clear();
+    pos.clear();
+    freeIds.clear();
+}
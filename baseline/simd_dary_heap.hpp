@@ -0,0 +1,111 @@
+#ifndef SIMD_DARY_HEAP_HPP
+#define SIMD_DARY_HEAP_HPP
+
+#include <vector>
+#include <stdexcept>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+#include "aligned_allocator.hpp"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define SIMD_DARY_X86 1
+#endif
+
+// min-child kernels: Scalar (d - 1 compares), SSE41 / AVX2 (pminsd + pcmpeqd + movemask);
+// Auto = the widest one this CPU supports (__builtin_cpu_supports)
+enum class SimdKernel { Auto, Scalar, SSE41, AVX2 };
+
+inline const char *simdKernelName(SimdKernel k) {
+    switch (k) {
+    case SimdKernel::SSE41: return "sse4.1";
+    case SimdKernel::AVX2:  return "avx2";
+    case SimdKernel::Scalar: return "scalar";
+    default: return "auto";
+    }
+}
+
+// widest kernel the running CPU supports (detected once)
+inline SimdKernel simdBestKernel() {
+#ifdef SIMD_DARY_X86
+    static const SimdKernel best = []() {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) return SimdKernel::AVX2;
+        if (__builtin_cpu_supports("sse4.1")) return SimdKernel::SSE41;
+        return SimdKernel::Scalar;
+    }();
+    return best;
+#else
+    return SimdKernel::Scalar;
+#endif
+}
+
+// min-d-ary heap on 32-bit integer keys (D = 8 or 16), lazy (no decreaseKey)
+//   SoA: keys and values in two arrays; the keys of the D children of a node are one aligned
+//   group of D * 4 bytes (16: one cache line), so siftDown finds the smallest child with one
+//   vector min over the group instead of d - 1 branchy compares
+//   the root sits at index D - 1, which puts every child group on a multiple of D;
+//   unused key slots hold INT32_MAX, so a partial last group needs no bounds check
+// The kernel is chosen at construction (Auto: runtime CPU detection, scalar fallback).
+template <typename Value = int, int D = 16>
+class SimdDaryHeap {
+    static_assert(D == 8 || D == 16, "SimdDaryHeap: D must be 8 or 16");
+
+    static constexpr std::size_t OFF = D - 1; // physical index of the root
+    static constexpr std::int32_t EMPTY = std::numeric_limits<std::int32_t>::max();
+
+    // keys[OFF + i] / values[i] = element i of the implicit d-ary heap
+    // keys.size() is a multiple of D and covers the child group of every element
+    std::vector<std::int32_t, AlignedAllocator<std::int32_t, D * sizeof(std::int32_t)>> keys;
+    std::vector<Value> values;
+    std::size_t count = 0;
+
+    SimdKernel kernelUsed;
+
+    // Percolate Up / Sift Up (hole-based, the value is already at slot)
+    void siftUp(std::size_t slot, std::int32_t key);
+
+    // Percolate Down / Sift Down (hole-based); MinChild(group) = offset of the smallest key in a child group
+    template <std::size_t (*MinChild)(const std::int32_t*)>
+    void siftDownWith(std::size_t slot, std::int32_t key, Value&& value);
+
+    // one entry point per kernel; flatten pulls the kernel into the loop (plain inlining stops
+    // at the target("...") boundary)
+    void siftDownScalar(std::size_t slot, std::int32_t key, Value&& value);
+#ifdef SIMD_DARY_X86
+    __attribute__((target("sse4.1"), flatten)) void siftDownSse41(std::size_t slot, std::int32_t key, Value&& value);
+    __attribute__((target("avx2"), flatten)) void siftDownAvx2(std::size_t slot, std::int32_t key, Value&& value);
+#endif
+
+public:
+    // kernel: Auto, or a specific one (falls back to the widest supported one below it)
+    explicit SimdDaryHeap(SimdKernel kernel = SimdKernel::Auto);
+    ~SimdDaryHeap() = default;
+
+    bool empty() const;
+    std::size_t size() const;
+
+    // kernel actually in use
+    SimdKernel kernel() const { return kernelUsed; }
+
+    std::int32_t minKey() const;
+    const Value& top() const;
+
+    void push(std::int32_t key, const Value& value);
+    void push(std::int32_t key, Value&& value);
+
+    void pop();
+
+    // pop and return the value of the min key (moved out, no copy)
+    Value deleteMin();
+
+    void clear();
+};
+
+
+#include "simd_dary_heap.ipp"
+
+#endif
@@ -0,0 +1,204 @@
+// Min-child kernels - offset of the smallest of the D keys at k (k aligned to D * 4 bytes)
+namespace simd_dary_detail {
+    template <int D>
+    inline std::size_t minChildScalar(const std::int32_t *k) {
+        std::size_t best = 0;
+        for (int j = 1; j < D; j++) {
+            if (k[j] < k[best]) best = j;
+        }
+        return best;
+    }
+
+#ifdef SIMD_DARY_X86
+    template <int D>
+    __attribute__((target("sse4.1"))) inline std::size_t minChildSse41(const std::int32_t *k) {
+        __m128i v[D / 4];
+        for (int j = 0; j < D / 4; j++) v[j] = _mm_load_si128(reinterpret_cast<const __m128i*>(k) + j);
+
+        // min of the group in every lane
+        __m128i m = v[0];
+        for (int j = 1; j < D / 4; j++) m = _mm_min_epi32(m, v[j]);
+        m = _mm_min_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2)));
+        m = _mm_min_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(2, 3, 0, 1)));
+
+        // first lane equal to it
+        unsigned mask = 0;
+        for (int j = 0; j < D / 4; j++) {
+            mask |= (unsigned)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v[j], m))) << (4 * j);
+        }
+        return __builtin_ctz(mask);
+    }
+
+    template <int D>
+    __attribute__((target("avx2"))) inline std::size_t minChildAvx2(const std::int32_t *k) {
+        __m256i v[D / 8];
+        for (int j = 0; j < D / 8; j++) v[j] = _mm256_load_si256(reinterpret_cast<const __m256i*>(k) + j);
+
+        __m256i m = v[0];
+        for (int j = 1; j < D / 8; j++) m = _mm256_min_epi32(m, v[j]);
+        m = _mm256_min_epi32(m, _mm256_permute2x128_si256(m, m, 1));
+        m = _mm256_min_epi32(m, _mm256_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2)));
+        m = _mm256_min_epi32(m, _mm256_shuffle_epi32(m, _MM_SHUFFLE(2, 3, 0, 1)));
+
+        unsigned mask = 0;
+        for (int j = 0; j < D / 8; j++) {
+            mask |= (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v[j], m))) << (8 * j);
+        }
+        return __builtin_ctz(mask);
+    }
+#endif
+}
+
+template <typename Value, int D>
+SimdDaryHeap<Value, D>::SimdDaryHeap(SimdKernel kernel) : keys(D, EMPTY) {
+    SimdKernel best = simdBestKernel();
+    if (kernel == SimdKernel::Auto || kernel > best) kernel = best;
+    kernelUsed = kernel;
+}
+
+// Sift Up - Push
+template <typename Value, int D>
+void SimdDaryHeap<Value, D>::siftUp(std::size_t slot, std::int32_t key) {
+    Value value = std::move(values[slot - OFF]);
+
+    while (slot > OFF) {
+        std::size_t parent = (slot - OFF - 1) / D + OFF;
+
+        if (key < keys[parent]) {
+            keys[slot] = keys[parent];
+            values[slot - OFF] = std::move(values[parent - OFF]);
+            slot = parent;
+        } else {
+            break;
+        }
+    }
+
+    keys[slot] = key;
+    values[slot - OFF] = std::move(value);
+}
+
+// Sift Down - Pop
+template <typename Value, int D>
+template <std::size_t (*MinChild)(const std::int32_t*)>
+void SimdDaryHeap<Value, D>::siftDownWith(std::size_t slot, std::int32_t key, Value&& value) {
+    const std::size_t end = count + OFF;
+
+    while (true) {
+        // child group of element i = slot - OFF starts at D * i + 1 + OFF = D * (i + 1)
+        std::size_t first = D * (slot - OFF + 1);
+        if (first >= end) break;
+
+        // padding keys are EMPTY, never smaller than key
+        std::size_t smallest = first + MinChild(&keys[first]);
+
+        if (keys[smallest] < key) {
+            keys[slot] = keys[smallest];
+            values[slot - OFF] = std::move(values[smallest - OFF]);
+            slot = smallest;
+        } else {
+            break;
+        }
+    }
+
+    keys[slot] = key;
+    values[slot - OFF] = std::move(value);
+}
+
+template <typename Value, int D>
+void SimdDaryHeap<Value, D>::siftDownScalar(std::size_t slot, std::int32_t key, Value&& value) {
+    siftDownWith<simd_dary_detail::minChildScalar<D>>(slot, key, std::move(value));
+}
+
+#ifdef SIMD_DARY_X86
+template <typename Value, int D>
+void SimdDaryHeap<Value, D>::siftDownSse41(std::size_t slot, std::int32_t key, Value&& value) {
+    siftDownWith<simd_dary_detail::minChildSse41<D>>(slot, key, std::move(value));
+}
+
+template <typename Value, int D>
+void SimdDaryHeap<Value, D>::siftDownAvx2(std::size_t slot, std::int32_t key, Value&& value) {
+    siftDownWith<simd_dary_detail::minChildAvx2<D>>(slot, key, std::move(value));
+}
+#endif
+
+template <typename Value, int D>
+bool SimdDaryHeap<Value, D>::empty() const {
+    return count == 0;
+}
+
+template <typename Value, int D>
+std::size_t SimdDaryHeap<Value, D>::size() const {
+    return count;
+}
+
+template <typename Value, int D>
+std::int32_t SimdDaryHeap<Value, D>::minKey() const {
+    if (empty()) {
+        throw std::runtime_error("SimdDaryHeap::minKey(): empty heap");
+    }
+    return keys[OFF];
+}
+
+template <typename Value, int D>
+const Value& SimdDaryHeap<Value, D>::top() const {
+    if (empty()) {
+        throw std::runtime_error("SimdDaryHeap::top(): empty heap");
+    }
+    return values[0];
+}
+
+template <typename Value, int D>
+void SimdDaryHeap<Value, D>::push(std::int32_t key, const Value& value) {
+    push(key, Value(value));
+}
+
+template <typename Value, int D>
+void SimdDaryHeap<Value, D>::push(std::int32_t key, Value&& value) {
+    std::size_t slot = count + OFF;
+    if (slot == keys.size()) {
+        keys.resize(keys.size() + D, EMPTY); // next child group
+    }
+    values.push_back(std::move(value));
+    count++;
+    siftUp(slot, key);
+}
+
+template <typename Value, int D>
+void SimdDaryHeap<Value, D>::pop() {
+    deleteMin();
+}
+
+template <typename Value, int D>
+Value SimdDaryHeap<Value, D>::deleteMin() {
+    if (empty()) {
+        throw std::runtime_error("SimdDaryHeap::deleteMin(): heap is empty");
+    }
+
+    Value result = std::move(values[0]);
+
+    // last element fills the root hole; its slot becomes padding
+    count--;
+    std::size_t last = count + OFF;
+    std::int32_t key = keys[last];
+    Value value = std::move(values[count]);
+    keys[last] = EMPTY;
+    values.pop_back();
+
+    if (count > 0) {
+        switch (kernelUsed) {
+#ifdef SIMD_DARY_X86
+        case SimdKernel::AVX2:  siftDownAvx2(OFF, key, std::move(value)); break;
+        case SimdKernel::SSE41: siftDownSse41(OFF, key, std::move(value)); break;
+#endif
+        default:                siftDownScalar(OFF, key, std::move(value)); break;
+        }
+    }
+    return result;
+}
+
+template <typename Value, int D>
+void SimdDaryHeap<Value, D>::clear() {
+    keys.assign(D, EMPTY);
+    values.clear();
+    count = 0;
+}
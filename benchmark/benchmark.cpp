@@ -5,21 +5,42 @@
 #include <chrono>
 #include <fstream>
 #include <iomanip>
+#include <functional>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <cstdlib>
+#include <sstream>
+#include <algorithm>
+#include <memory>
 
 #include "../baseline/binary_heap.hpp" // min-binary-heap
+#include "../baseline/b_heap.hpp" // min-heap, blocked (B-heap) layout
+#include "../baseline/simd_dary_heap.hpp" // min-16-ary heap on int32 keys, SIMD min-child
+#include "../baseline/dary_heap.hpp" // addressable min-d-ary-heap
 #include "../datastructure/origin/pairing_heap_no.hpp" // min-pairing-heap (no memory pool)
 #include "../datastructure/optimize/pairing_heap.hpp" // min-pairing-heap
+#include "../datastructure/optimize/compact_pairing_heap.hpp" // min-pairing-heap (32-bit index links)
+#include "../datastructure/optimize/keyed_pairing_heap.hpp" // min-pairing-heap (keys + links apart from payloads)
+#include "../datastructure/optimize/fibonacci_heap.hpp" // min-fibonacci-heap
+#include "../datastructure/optimize/rank_pairing_heap.hpp" // min-rank-pairing-heap (type 1)
+#include "../datastructure/optimize/radix_heap.hpp" // monotone integer priority queue
+#include "../datastructure/optimize/multi_queue.hpp" // relaxed concurrent priority queue
+#include "graph.hpp" // CSR graph + generate_graph
+#include "dijkstra.hpp" // dijkstra<Queue> + QueueTraits
+#include "graph_io.hpp" // DIMACS .gr loader + mmap binary cache
+#include "delta_stepping.hpp" // parallel delta-stepping SSSP
+#include "query_engine.hpp" // repeated point-to-point queries on persistent workspaces
+#include "harness.hpp" // CLI options, sample statistics, CPU pinning, host info
+#include "perf_counters.hpp" // perf_event_open hardware counters
+#include "trace.hpp" // heap operation trace format + recording wrapper
+#include "trace_replay.hpp" // trace replay drivers
 
 using namespace std;
 
 const int INF = 1e9;
 const int V_FIXED = 4000;
 
-struct Edge {
-    int to;
-    int weight;
-};
-
 struct State {
     int dist; // min dist
     int vertex; // index of vertex
@@ -35,33 +56,15 @@ struct State {
     }
 };
 
-vector<vector<Edge>> generate_graph(int V, double density) {
-    vector<vector<Edge>> adj(V);
-
-    long long max_edges = (long long)(V) * (V - 1); // maximum number of the graph
-    long long target_edges = max_edges * (density / 100.0); // target_edges = max_edges * density
-
-    static mt19937 gen(42);
-    uniform_int_distribution<> dis_vertex(0, V - 1);
-    uniform_int_distribution<> dis_weight(1, 100); // 1 ~ 100
-
-    for (long long i = 0; i < target_edges; ++i) {
-        int u = dis_vertex(gen);
-        int v = dis_vertex(gen);
-        if(u == v) {
-            // avoid self-loop
-            i--;
-            continue;
-        }
-
-        adj[u].push_back({v, dis_weight(gen)});
-    }
-
-    return adj;
-}
+// traces record the distance of a State
+template <>
+struct TraceKey<State> {
+    static std::int32_t get(const State &s) { return s.dist; }
+};
 
-// pure-array method
-void dijkstra_brutal(int V, const vector<vector<Edge>> &adj) {
+// pure-array method (no queue, so not through dijkstra<Queue>)
+vector<int> dijkstra_brutal(const Graph &g) {
+    int V = g.V;
     vector<int> dist(V, INF);
     vector<bool> vis(V, false);
 
@@ -82,224 +85,1135 @@ void dijkstra_brutal(int V, const vector<vector<Edge>> &adj) {
         vis[u] = true;
 
         // 2. Relax edges
-        for (const auto &edge : adj[u]) {
-            if (dist[u] + edge.weight < dist[edge.to]) {
-                dist[edge.to] = dist[u] + edge.weight;
+        for (long long e = g.offsets[u]; e < g.offsets[u + 1]; e++) {
+            if (dist[u] + g.weight[e] < dist[g.to[e]]) {
+                dist[g.to[e]] = dist[u] + g.weight[e];
             }
         }
     }
+
+    return dist;
 }
 
-// std::priority_queue
-void dijkstra_std(int V, const vector<vector<Edge>> &adj) {
-    // greater min-heap
-    priority_queue<State, vector<State>, greater<State>> pq;
-    vector<int> dist(V, INF);
+// greater min-heap: lazy (no decreaseKey), the reference answer of the harness
+using StdQueue = priority_queue<State, vector<State>, greater<State>>;
 
-    dist[0] = 0;
-    pq.push({0, 0});
+// min-pairing-heap (Pairing: deleteMin strategy, see pairing_policy.hpp)
+// poolStats (optional): node pool counters at the end of the run
+// Record = true: every heap operation is written to `trace` (Record = false compiles it out)
+// Stats = Opt::CountingStats: structural counters are copied to `counters` at the end
+// Elem: heap element ({dist, vertex} + whatever payload, see run_payload_benchmark)
+// Locality: prefetch hints / node allocation order (see prefetch_policy.hpp, run_locality_benchmark)
+template <typename Pairing = Opt::TwoPass, bool Record = false, typename Stats = Opt::NoStats, typename Elem = State,
+          typename Locality = Opt::NoPrefetch>
+vector<int> dijkstra_pairing(const Graph &g, PoolStats *poolStats = nullptr, TraceWriter *trace = nullptr,
+                             Opt::PairingCounters *counters = nullptr) {
+    TracingHeap<Opt::PairingHeap<Elem, Pairing, Stats, Locality>, Record> pq;
+    pq.attach(trace);
+    vector<int> dist = dijkstra(g, pq);
 
-    while (!pq.empty()) {
-        State top = pq.top();
-        pq.pop();
+    if (poolStats) *poolStats = pq.poolStats();
+    if constexpr (Stats::enabled) {
+        if (counters) *counters = pq.stats().counters;
+    }
+    return dist;
+}
+
+// one extra (untimed) run of a pairing variant with Opt::CountingStats
+template <typename Pairing>
+void count_pairing(const Graph &g, Opt::PairingCounters *counters) {
+    dijkstra_pairing<Pairing, false, Opt::CountingStats>(g, nullptr, nullptr, counters);
+}
+
+// any MemoryPool-backed queue: dijkstra + the pool counters at the end of the run
+template <typename Queue>
+vector<int> dijkstra_pooled(const Graph &g, PoolStats *poolStats = nullptr) {
+    Queue pq;
+    vector<int> dist = dijkstra(g, pq);
+    if (poolStats) *poolStats = pq.poolStats();
+    return dist;
+}
+
+template<typename Func>
+double measure_time(Func func) {
+    auto start = chrono::high_resolution_clock::now();
+    func();
+    auto end = chrono::high_resolution_clock::now();
+    
+    // return (ms)
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+// build + teardown cycles: the heap is rebuilt per query, so teardown is part of every query
+// build = n inserts + n/2 deleteMin (gives a real tree shape), teardown = clear() / reset() / dtor
+void run_teardown_benchmark() {
+    const int CYCLES = 20;
+    const vector<int> sizes = {1000, 10000, 100000, 1000000};
+
+    ofstream csv("teardown_result.csv");
+    csv << "N,Build(ms),Clear(ms),Reset(ms),NoPool_Clear(ms)\n";
+
+    cout << "Build + Teardown (" << CYCLES << " cycles per size)" << endl;
+    cout << fixed << setprecision(3);
+
+    mt19937 gen(42);
+    for (int n : sizes) {
+        uniform_int_distribution<> dis(0, INF);
+        vector<State> keys(n);
+        for (int i = 0; i < n; i++) keys[i] = {dis(gen), i};
+
+        Opt::PairingHeap<State> pq;
+        Origin::PairingHeap_NO<State> pq_no;
 
-        int d = top.dist;
-        int u = top.vertex;
+        auto build = [&](auto &heap) {
+            for (const State &s : keys) heap.insert(s);
+            for (int i = 0; i < n / 2; i++) heap.deleteMin();
+        };
 
-        if (d > dist[u]) continue;
+        double t_build = 0, t_clear = 0, t_reset = 0, t_no = 0;
+        for (int c = 0; c < CYCLES; c++) {
+            t_build += measure_time([&]() { build(pq); });
+            t_clear += measure_time([&]() { pq.clear(); });
 
-        for (const auto &edge : adj[u]) {
-            int v = edge.to;
-            int weight = edge.weight;
+            build(pq);
+            t_reset += measure_time([&]() { pq.reset(); });
 
-            if (dist[u] + weight < dist[v]) {
-                dist[v] = dist[u] + weight;
-                pq.push({dist[v], v});
+            build(pq_no);
+            t_no += measure_time([&]() { pq_no.clear(); });
+        }
+
+        cout << "   N = " << n
+             << "\n      Build:          " << t_build / CYCLES << " ms"
+             << "\n      Clear (walk):   " << t_clear / CYCLES << " ms"
+             << "\n      Reset (O(1)):   " << t_reset / CYCLES << " ms"
+             << "\n      NoPool clear(): " << t_no / CYCLES << " ms" << endl;
+
+        csv << n << "," << t_build / CYCLES << "," << t_clear / CYCLES << ","
+            << t_reset / CYCLES << "," << t_no / CYCLES << "\n";
+    }
+
+    cout << "Data saved to 'teardown_result.csv'" << endl;
+}
+
+// bulk build vs n repeated inserts (PairingHeap: binary-counter build, BinaryHeap: Floyd heapify)
+// drain = deleteMin until empty, shows whether the build just pushes work into deleteMin
+void run_bulk_benchmark() {
+    const vector<int> sizes = {1000, 10000, 100000, 1000000};
+
+    ofstream csv("bulk_result.csv");
+    csv << "N,Pairing_Insert(ms),Pairing_Batch(ms),Pairing_Insert_Drain(ms),Pairing_Batch_Drain(ms),"
+        << "Binary_Push(ms),Binary_Heapify(ms)\n";
+
+    cout << "Bulk build vs repeated insert" << endl;
+    cout << fixed << setprecision(3);
+
+    mt19937 gen(42);
+    for (int n : sizes) {
+        uniform_int_distribution<> dis(0, INF);
+        vector<State> keys(n);
+        for (int i = 0; i < n; i++) keys[i] = {dis(gen), i};
+
+        auto drain = [](auto &heap) { while (!heap.empty()) heap.deleteMin(); };
+
+        Opt::PairingHeap<State> one_by_one;
+        double t_insert = measure_time([&]() { for (const State &s : keys) one_by_one.insert(s); });
+        double t_insert_drain = measure_time([&]() { drain(one_by_one); });
+
+        Opt::PairingHeap<State> bulk;
+        double t_batch = measure_time([&]() { bulk.insertBatch(keys.begin(), keys.end()); });
+        double t_batch_drain = measure_time([&]() { drain(bulk); });
+
+        double t_push = measure_time([&]() {
+            BinaryHeap<State> heap;
+            for (const State &s : keys) heap.push(s);
+        });
+        double t_heapify = measure_time([&]() { BinaryHeap<State> heap(keys.begin(), keys.end()); });
+
+        cout << "   N = " << n
+             << "\n      Pairing insert x n: " << t_insert << " ms (drain " << t_insert_drain << " ms)"
+             << "\n      Pairing insertBatch: " << t_batch << " ms (drain " << t_batch_drain << " ms)"
+             << "\n      Binary push x n:    " << t_push << " ms"
+             << "\n      Binary heapify:     " << t_heapify << " ms" << endl;
+
+        csv << n << "," << t_insert << "," << t_batch << "," << t_insert_drain << "," << t_batch_drain << ","
+            << t_push << "," << t_heapify << "\n";
+    }
+
+    cout << "Data saved to 'bulk_result.csv'" << endl;
+}
+
+// State + Pad bytes of payload (a stand-in for the records a real queue carries)
+template <size_t Pad>
+struct FatState {
+    int dist;
+    int vertex;
+    char pad[Pad] = {};
+
+    bool operator>(const FatState& other) const { return dist > other.dist; }
+    bool operator<(const FatState& other) const { return dist < other.dist; }
+};
+
+// Dijkstra with growing element size: the inline heaps (Opt / Compact) carry the payload in
+// every node, the keyed heap keeps only the int key next to the links
+template <size_t Pad>
+void payload_row(const Graph &g, int reps, ofstream &csv) {
+    auto median = [&](const function<void()> &fn) {
+        vector<double> ms;
+        for (int r = 0; r < reps; r++) ms.push_back(measure_time(fn));
+        return summarize(ms).median;
+    };
+
+    double t_opt = median([&]() { dijkstra_pairing<Opt::TwoPass, false, Opt::NoStats, FatState<Pad>>(g); });
+    double t_compact = median([&]() { dijkstra<Opt::CompactPairingHeap<FatState<Pad>>>(g); });
+    double t_keyed = median([&]() { dijkstra<Opt::KeyedPairingHeap<int, FatState<Pad>>>(g); });
+
+    cout << "   element = " << sizeof(FatState<Pad>) << " B"
+         << "\n      Pairing_OPT:     " << t_opt << " ms"
+         << "\n      Pairing_Compact: " << t_compact << " ms"
+         << "\n      Pairing_Keyed:   " << t_keyed << " ms" << endl;
+
+    csv << sizeof(FatState<Pad>) << "," << t_opt << "," << t_compact << "," << t_keyed << "\n";
+}
+
+// usage: ./benchmark payload [V density]
+void run_payload_benchmark(int V, double density) {
+    const int REPS = 5;
+    Graph g = generate_graph(V, density);
+
+    ofstream csv("payload_result.csv");
+    csv << "ElementBytes,Pairing_OPT(ms),Pairing_Compact(ms),Pairing_Keyed(ms)\n";
+
+    cout << "Payload size (V = " << V << ", density = " << density << "%, median of " << REPS << ")" << endl;
+    cout << fixed << setprecision(3);
+
+    payload_row<8>(g, REPS, csv);
+    payload_row<56>(g, REPS, csv);
+    payload_row<248>(g, REPS, csv);
+
+    cout << "Data saved to 'payload_result.csv'" << endl;
+}
+
+// how the huge-page backend got its memory on this host (one probe pool, one node)
+template <typename Backend>
+string huge_page_backing() {
+    MemoryPool<Opt::Node<State>, 4096, ReuseFirst, Backend> probe;
+    probe.deallocate(probe.allocate(std::in_place, State{0, 0}));
+    const Backend &b = probe.backend();
+
+    string out = b.hugeTlbBytes() ? "MAP_HUGETLB" : b.hugeAdvisedBytes() ? "madvise(MADV_HUGEPAGE)" : "4 KiB pages";
+    ifstream thp("/sys/kernel/mm/transparent_hugepage/enabled");
+    string mode;
+    if (!b.hugeTlbBytes() && getline(thp, mode)) out += ", THP " + mode;
+    if (b.numaBoundBytes()) out += ", bound to the local NUMA node";
+    return out;
+}
+
+// Locality policies of Opt::PairingHeap on sparse random graphs whose heap outgrows the
+// last-level cache: median time + median hardware counters per policy, and the change of
+// time / LLC misses / dTLB misses against the first policy (NoPrefetch)
+//   prefetch:  prefetch hints and node allocation order (prefetch_result.csv)
+//   hugepages: huge-page / NUMA-bound node blocks (hugepage_result.csv)
+// usage: ./benchmark prefetch|hugepages [V avg_degree reps]
+void run_locality_benchmark(const string &mode, int V, double degree, int reps) {
+    struct Policy {
+        string name;
+        function<vector<int>(const Graph&, PoolStats*)> run;
+    };
+    vector<Policy> policies = {
+        {"NoPrefetch",    [](const Graph &g, PoolStats *s) { return dijkstra_pairing<Opt::TwoPass, false, Opt::NoStats, State, Opt::NoPrefetch>(g, s); }},
+    };
+    if (mode == "prefetch") {
+        policies.push_back({"Prefetch",      [](const Graph &g, PoolStats *s) { return dijkstra_pairing<Opt::TwoPass, false, Opt::NoStats, State, Opt::Prefetch>(g, s); }});
+        policies.push_back({"FreshNodes",    [](const Graph &g, PoolStats *s) { return dijkstra_pairing<Opt::TwoPass, false, Opt::NoStats, State, Opt::FreshNodes>(g, s); }});
+        policies.push_back({"PrefetchFresh", [](const Graph &g, PoolStats *s) { return dijkstra_pairing<Opt::TwoPass, false, Opt::NoStats, State, Opt::PrefetchFresh>(g, s); }});
+    } else {
+        policies.push_back({"HugePages",     [](const Graph &g, PoolStats *s) { return dijkstra_pairing<Opt::TwoPass, false, Opt::NoStats, State, Opt::HugePages>(g, s); }});
+        policies.push_back({"NumaHugePages", [](const Graph &g, PoolStats *s) { return dijkstra_pairing<Opt::TwoPass, false, Opt::NoStats, State, Opt::NumaHugePages>(g, s); }});
+    }
+    string out = mode == "prefetch" ? "prefetch_result.csv" : "hugepage_result.csv";
+
+    Graph g = generate_graph(V, 100.0 * degree / (V - 1));
+    vector<int> reference = dijkstra<StdQueue>(g);
+
+    // peak heap footprint = peak live nodes * node size (same for every policy)
+    PoolStats pool{0, 0, 0, 0};
+    dijkstra_pairing(g, &pool);
+    long long heap_bytes = (long long)pool.peak * sizeof(Opt::Node<State>);
+    long long llc = collect_host_info().llcBytes;
+
+    cout << (mode == "prefetch" ? "Prefetch / allocation order" : "Huge-page node blocks")
+         << " (V = " << V << ", E = " << g.numEdges() << ", median of " << reps << ")" << endl;
+    cout << "   peak heap: " << pool.peak << " nodes = " << (heap_bytes >> 20) << " MiB, LLC: ";
+    if (llc > 0) cout << (llc >> 20) << " MiB" << endl;
+    else cout << "unknown" << endl;
+    if (llc > 0 && heap_bytes <= llc) cout << "   Warning: the heap fits in the LLC, raise V or the degree" << endl;
+    if (mode != "prefetch") {
+        cout << "   HugePages backing:     " << huge_page_backing<HugePageBackend<>>() << endl;
+        cout << "   NumaHugePages backing: " << huge_page_backing<NumaHugePageBackend>() << endl;
+    }
+
+    PerfCounters counters;
+    if (!counters.available()) cout << "   (hardware counters unavailable: " << counters.error() << ", timing only)" << endl;
+
+    ofstream csv(out);
+    csv << "Policy,V,E,PeakHeapBytes,LLCBytes,Median(ms)";
+    for (int e = 0; e < PerfCounters::COUNT; e++) csv << "," << PerfCounters::name(e);
+    csv << ",TimeDelta(%),LLCMissDelta(%),dTLBMissDelta(%),Verified\n";
+
+    // change against the first policy, empty when either side is missing
+    auto delta = [](double base, double x) {
+        return (base > 0 && x >= 0) ? to_string(100.0 * (x - base) / base) : string();
+    };
+    double base_ms = -1, base_llc = -1, base_tlb = -1;
+
+    cout << fixed << setprecision(2);
+    for (const Policy &p : policies) {
+        vector<double> ms;
+        vector<vector<double>> values(PerfCounters::COUNT);
+        bool correct = true;
+        for (int r = 0; r < reps; r++) {
+            vector<int> dist;
+            counters.start();
+            ms.push_back(measure_time([&]() { dist = p.run(g, nullptr); }));
+            PerfCounters::Values v = counters.stop();
+            for (int e = 0; e < PerfCounters::COUNT; e++) {
+                if (v[e] >= 0) values[e].push_back(v[e]);
             }
+            correct = correct && dist == reference;
         }
+
+        double t = summarize(ms).median;
+        PerfCounters::Values m;
+        for (int e = 0; e < PerfCounters::COUNT; e++) m[e] = values[e].empty() ? -1.0 : summarize(values[e]).median;
+        if (base_ms < 0) {
+            base_ms = t;
+            base_llc = m[PerfCounters::LLC_MISSES];
+            base_tlb = m[PerfCounters::DTLB_MISSES];
+        }
+
+        cout << "   " << left << setw(14) << p.name << right << "median " << setw(9) << t << " ms";
+        if (p.name != policies.front().name) cout << " (" << showpos << 100.0 * (t - base_ms) / base_ms << noshowpos << "%)";
+        if (m[PerfCounters::LLC_MISSES] >= 0) cout << "   LLC miss " << (long long)m[PerfCounters::LLC_MISSES];
+        if (m[PerfCounters::DTLB_MISSES] >= 0) cout << "   dTLB miss " << (long long)m[PerfCounters::DTLB_MISSES];
+        if (!correct) cout << "   WRONG DISTANCES";
+        cout << endl;
+
+        csv << p.name << "," << V << "," << g.numEdges() << "," << heap_bytes << "," << llc << "," << t;
+        for (int e = 0; e < PerfCounters::COUNT; e++) {
+            csv << ",";
+            if (m[e] >= 0) csv << (long long)m[e];
+        }
+        csv << "," << delta(base_ms, t) << "," << delta(base_llc, m[PerfCounters::LLC_MISSES])
+            << "," << delta(base_tlb, m[PerfCounters::DTLB_MISSES]) << "," << (correct ? "ok" : "mismatch") << "\n";
     }
+
+    cout << "Data saved to '" << out << "'" << endl;
 }
 
-// min-binary-heap
-void dijkstra_binary(int V, const vector<vector<Edge>> &adj) {
-    BinaryHeap<State> pq;
-    vector<int> dist(V, INF);
+// MultiQueue throughput vs threads, against one PairingHeap behind a global mutex
+// every thread runs (insert random key, deleteMin) pairs on a prefilled queue
+// usage: ./benchmark multiqueue [max_threads]
+void run_multiqueue_benchmark(int max_threads) {
+    const int PREFILL = 100000;
+    const int TOTAL_PAIRS = 2000000;
 
-    dist[0] = 0;
-    pq.push({0, 0});
+    vector<int> thread_counts;
+    for (int t = 1; t < max_threads; t *= 2) thread_counts.push_back(t);
+    thread_counts.push_back(max_threads);
 
-    while (!pq.empty()) {
-        State top = pq.top();
-        pq.pop();
+    ofstream csv("multiqueue_result.csv");
+    csv << "Threads,MultiQueue(Mops/s),GlobalLock(Mops/s)\n";
 
-        int d = top.dist;
-        int u = top.vertex;
+    cout << "MultiQueue throughput (" << TOTAL_PAIRS << " insert+deleteMin pairs, prefill " << PREFILL << ")" << endl;
+    cout << fixed << setprecision(2);
 
-        if (d > dist[u]) continue;
+    for (int threads : thread_counts) {
+        int pairs_per_thread = TOTAL_PAIRS / threads;
 
-        for (const auto &edge : adj[u]) {
-            int v = edge.to;
-            int weight = edge.weight;
+        // run body(tid) on `threads` threads and return elapsed ms
+        auto run_threads = [&](const function<void(int)> &body) {
+            return measure_time([&]() {
+                vector<thread> pool;
+                for (int t = 0; t < threads; t++) pool.emplace_back(body, t);
+                for (auto &th : pool) th.join();
+            });
+        };
 
-            if (dist[u] + weight < dist[v]) {
-                dist[v] = dist[u] + weight;
-                pq.push({dist[v], v});
+        Opt::MultiQueue<int> mq(threads);
+        {
+            mt19937 gen(42);
+            for (int i = 0; i < PREFILL; i++) mq.insert(gen() % INF);
+        }
+        double t_mq = run_threads([&](int tid) {
+            mt19937 gen(tid + 1);
+            int out;
+            for (int i = 0; i < pairs_per_thread; i++) {
+                mq.insert(gen() % INF);
+                mq.tryDeleteMin(out);
             }
+        });
+
+        Opt::PairingHeap<int> global;
+        mutex global_lock;
+        {
+            mt19937 gen(42);
+            for (int i = 0; i < PREFILL; i++) global.insert(gen() % INF);
         }
+        double t_lock = run_threads([&](int tid) {
+            mt19937 gen(tid + 1);
+            for (int i = 0; i < pairs_per_thread; i++) {
+                int key = gen() % INF;
+                lock_guard<mutex> guard(global_lock);
+                global.insert(key);
+                global.deleteMin();
+            }
+        });
+
+        double ops = 2.0 * pairs_per_thread * threads;
+        double mops_mq = ops / (t_mq * 1000.0);
+        double mops_lock = ops / (t_lock * 1000.0);
+
+        cout << "   " << setw(3) << threads << " threads: MultiQueue " << mops_mq << " Mops/s ("
+             << mq.shardCount() << " shards), global lock " << mops_lock << " Mops/s" << endl;
+        csv << threads << "," << mops_mq << "," << mops_lock << "\n";
     }
+
+    cout << "Data saved to 'multiqueue_result.csv'" << endl;
 }
 
-// Pairing Heap (NO Memory Pool)
-void dijkstra_pairing_no(int V, const vector<vector<Edge>> &adj) {
-    Origin::PairingHeap_NO<State> pq;
-    vector<int> dist(V, INF);
-    vector<Origin::Node<State> *> handles(V, nullptr);
-    
-    dist[0] = 0;
-    handles[0] = pq.insert({0, 0});
-    
-    while (!pq.empty()) {
-        State top = pq.getMin();
-        pq.deleteMin();
+// every single-source variant, in CSV column order;
+// `mode` is the perf-mode name, pool-backed variants also fill PoolStats,
+// `structure` (Opt::PairingHeap variants only) is an untimed run with structural counters
+struct Variant {
+    string name;
+    string mode;
+    function<vector<int>(const Graph&, PoolStats*)> run; // returns the distances from vertex 0
+    function<void(const Graph&, Opt::PairingCounters*)> structure = nullptr;
+};
 
-        int u = top.vertex;
-        handles[u] = nullptr;
-        
-        for (const auto &edge : adj[u]) {
-            int v = edge.to;
-            int weight = edge.weight;
-            int new_dist = dist[u] + weight;
-            
-            if (new_dist < dist[v]) {
-                dist[v] = new_dist;
-                if (handles[v] == nullptr) {
-                    handles[v] = pq.insert({new_dist, v});
-                } else {
-                    pq.decreaseKey(handles[v], {new_dist, v});
+vector<Variant> all_variants() {
+    return {
+        {"Linear",             "brutal",            [](const Graph &g, PoolStats*) { return dijkstra_brutal(g); }},
+        {"Std_PQ",             "std",               [](const Graph &g, PoolStats*) { return dijkstra<StdQueue>(g); }},
+        {"Binary",             "binary",            [](const Graph &g, PoolStats*) { return dijkstra<BinaryHeap<State>>(g); }},
+        {"BHeap",              "bheap",             [](const Graph &g, PoolStats*) { return dijkstra<BHeap<State>>(g); }},
+        {"SimdDary16",         "simd_dary16",       [](const Graph &g, PoolStats*) { return dijkstra<SimdDaryHeap<int, 16>>(g); }},
+        {"SimdDary16_Scalar",  "simd_dary16_scalar", [](const Graph &g, PoolStats*) {
+                                                        SimdDaryHeap<int, 16> pq(SimdKernel::Scalar);
+                                                        return dijkstra(g, pq); }},
+        {"Pairing_NoPool",     "pairing_no",        [](const Graph &g, PoolStats*) { return dijkstra<Origin::PairingHeap_NO<State>>(g); }},
+        {"Pairing_OPT",        "pairing",           [](const Graph &g, PoolStats *s) { return dijkstra_pairing(g, s); },
+                                                    count_pairing<Opt::TwoPass>},
+        {"Pairing_Compact",    "pairing_compact",   [](const Graph &g, PoolStats*) { return dijkstra<Opt::CompactPairingHeap<State>>(g); }},
+        {"Pairing_Keyed",      "pairing_keyed",     [](const Graph &g, PoolStats*) { return dijkstra<Opt::KeyedPairingHeap<int, State>>(g); }},
+        {"Pairing_MultiPass",  "pairing_multipass", [](const Graph &g, PoolStats *s) { return dijkstra_pairing<Opt::MultiPass>(g, s); },
+                                                    count_pairing<Opt::MultiPass>},
+        {"Pairing_F2B",        "pairing_f2b",       [](const Graph &g, PoolStats *s) { return dijkstra_pairing<Opt::FrontToBack>(g, s); },
+                                                    count_pairing<Opt::FrontToBack>},
+        {"Pairing_AuxTwoPass", "pairing_aux",       [](const Graph &g, PoolStats *s) { return dijkstra_pairing<Opt::AuxTwoPass>(g, s); },
+                                                    count_pairing<Opt::AuxTwoPass>},
+        {"Pairing_Prefetch",   "pairing_prefetch",  [](const Graph &g, PoolStats *s) {
+                                                        return dijkstra_pairing<Opt::TwoPass, false, Opt::NoStats, State, Opt::PrefetchFresh>(g, s); }},
+        {"Pairing_HugePages",  "pairing_hugepages", [](const Graph &g, PoolStats *s) {
+                                                        return dijkstra_pairing<Opt::TwoPass, false, Opt::NoStats, State, Opt::HugePages>(g, s); }},
+        {"Dary2",              "dary2",             [](const Graph &g, PoolStats*) { return dijkstra<DaryHeap<State, 2>>(g); }},
+        {"Dary4",              "dary4",             [](const Graph &g, PoolStats*) { return dijkstra<DaryHeap<State, 4>>(g); }},
+        {"Dary8",              "dary8",             [](const Graph &g, PoolStats*) { return dijkstra<DaryHeap<State, 8>>(g); }},
+        {"Radix",              "radix",             [](const Graph &g, PoolStats*) { return dijkstra<Opt::RadixHeap<int>>(g); }},
+        {"Fibonacci",          "fibonacci",         [](const Graph &g, PoolStats *s) { return dijkstra_pooled<Opt::FibonacciHeap<State>>(g, s); }},
+        {"Rank_Pairing",       "rank_pairing",      [](const Graph &g, PoolStats *s) { return dijkstra_pooled<Opt::RankPairingHeap<State>>(g, s); }},
+    };
+}
+
+bool uses_pool(const string &name) {
+    return name == "Pairing_OPT" || name == "Pairing_MultiPass" || name == "Pairing_F2B" || name == "Pairing_AuxTwoPass"
+        || name == "Pairing_Prefetch" || name == "Pairing_HugePages"
+        || name == "Fibonacci" || name == "Rank_Pairing";
+}
+
+// density sweep / graph-file harness (see harness.hpp for the options)
+//   - per graph: `warmup` untimed rounds, then `reps` timed rounds; every round runs each
+//     variant once in a freshly shuffled order, so drift hits all variants alike
+//   - <out>.csv:       Density(%) + median per variant (plot input, seeds pooled)
+//   - <out>_stats.csv: one row per (graph, variant): min / median / mean / p90 / p99 / max / stddev,
+//                      then the median hardware counters of the timed runs (empty when unavailable)
+//   - <out>.json:      the same rows + raw samples + compiler flags and host info
+//   - pool_stats.csv:  MemoryPool counters of the pool-backed variants
+//   - pairing_stats.csv: links / cuts / pairing-list lengths / depths of the Opt::PairingHeap variants
+//   - the first run of every variant on a graph is checked against a Std_PQ run (Verified column);
+//     any mismatch makes the sweep exit with 1
+int run_sweep(const BenchOptions &opt) {
+    vector<Variant> variants;
+    for (Variant &v : all_variants()) {
+        if (opt.variants.empty() || find(opt.variants.begin(), opt.variants.end(), v.name) != opt.variants.end()) {
+            variants.push_back(v);
+        }
+    }
+    for (const string &name : opt.variants) {
+        bool known = false;
+        for (const Variant &v : variants) known = known || v.name == name;
+        if (!known) {
+            cerr << "Error: unknown variant " << name << endl;
+            return 1;
+        }
+    }
+
+    bool pinned = opt.pinCpu >= 0 && pin_to_cpu(opt.pinCpu);
+    if (opt.pinCpu >= 0 && !pinned) cerr << "Warning: could not pin to CPU " << opt.pinCpu << endl;
+
+    HostInfo host = collect_host_info();
+
+    unique_ptr<PerfCounters> counters;
+    if (opt.counters) {
+        counters.reset(new PerfCounters());
+        if (!counters->available()) {
+            cerr << "Note: hardware counters unavailable (" << counters->error() << "), timing only" << endl;
+            counters.reset();
+        } else if (!counters->error().empty()) {
+            cerr << "Note: some hardware counters unavailable (" << counters->error() << ")" << endl;
+        }
+    }
+
+    // median of one counter over the timed runs, -1 if it never produced a value
+    auto counter_median = [](const vector<PerfCounters::Values> &runs, int e) {
+        vector<double> values;
+        for (const auto &v : runs) {
+            if (v[e] >= 0) values.push_back(v[e]);
+        }
+        return values.empty() ? -1.0 : summarize(values).median;
+    };
+    mt19937 order_gen(opt.orderSeed);
+
+    // uniform: one group per density; grid / file: a single group
+    vector<double> groups = opt.family == "uniform" ? opt.densities : vector<double>{0.0};
+    vector<unsigned> seeds = opt.family == "file" ? vector<unsigned>{opt.seeds.front()} : opt.seeds;
+
+    ofstream csv(opt.out + ".csv");
+    csv << "Density(%)";
+    for (const Variant &v : variants) csv << "," << v.name << "(ms)";
+    csv << "\n";
+
+    ofstream stats_csv(opt.out + "_stats.csv");
+    stats_csv << "Family,Seed,V,E,Density(%),Variant,Reps,Min(ms),Median(ms),Mean(ms),P90(ms),P99(ms),Max(ms),Stddev(ms)";
+    for (int e = 0; e < PerfCounters::COUNT; e++) stats_csv << "," << PerfCounters::name(e);
+    stats_csv << ",IPC,Verified\n";
+
+    ofstream pool_csv("pool_stats.csv");
+    pool_csv << "Density(%),Seed,Variant,LiveNodes,PeakNodes,Blocks,BytesReserved\n";
+
+    // structural counters of the Opt::PairingHeap variants (one untimed run per graph);
+    // DepthHist / CombineHist: '|'-separated log2 buckets, bucket b = [2^b - 1, 2^(b+1) - 1)
+    ofstream structure_csv("pairing_stats.csv");
+    structure_csv << "Density(%),Seed,Variant,Inserts,DeleteMins,DecreaseKeys,Cuts,Links,LinksPerOp,"
+                  << "Combines,AvgCombineLen,MaxCombineLen,DepthSamples,AvgDepth,MaxDepth,CombineHist,DepthHist\n";
+
+    auto histogram = [](const uint64_t (&hist)[Opt::PairingCounters::BUCKETS]) {
+        int last = Opt::PairingCounters::BUCKETS - 1;
+        while (last > 0 && hist[last] == 0) last--;
+        string out;
+        for (int b = 0; b <= last; b++) out += (b ? "|" : "") + to_string(hist[b]);
+        return out;
+    };
+
+    ostringstream json_rows;
+    json_rows << fixed << setprecision(4);
+    bool first_row = true;
+    vector<string> wrong; // "variant @ graph" whose distances differ from Std_PQ
+
+    cout << "Starting Benchmark (family = " << opt.family << ", reps = " << opt.reps
+         << ", warmup = " << opt.warmup << ", pinned = " << (pinned ? to_string(opt.pinCpu) : "no") << ")" << endl;
+    cout << fixed << setprecision(2);
+
+    for (double group : groups) {
+        vector<vector<double>> pooled(variants.size());
+        double density = group;
+
+        for (unsigned seed : seeds) {
+            Graph graph;
+            if (opt.family == "uniform") graph = generate_graph(opt.V, group, seed);
+            else if (opt.family == "grid") graph = generate_grid(opt.V, seed);
+            else graph = load_graph(opt.graphPath);
+
+            if (opt.family != "uniform") {
+                density = 100.0 * graph.numEdges() / ((double)graph.V * (graph.V - 1));
+            }
+            cout << "Running " << opt.family << " V = " << graph.V << ", E = " << graph.numEdges()
+                 << ", density = " << density << "%, seed = " << seed << endl;
+
+            // O(V^2) linear scan only on small graphs
+            vector<size_t> active;
+            for (size_t i = 0; i < variants.size(); i++) {
+                if (variants[i].name != "Linear" || graph.V <= 50000) active.push_back(i);
+            }
+
+            vector<PoolStats> pool(variants.size(), PoolStats{0, 0, 0, 0});
+            vector<vector<double>> samples(variants.size());
+            vector<vector<PerfCounters::Values>> counter_samples(variants.size());
+
+            vector<int> reference = dijkstra<StdQueue>(graph);
+            vector<char> checked(variants.size(), 0), correct(variants.size(), 1);
+
+            for (int round = 0; round < opt.warmup + opt.reps; round++) {
+                shuffle(active.begin(), active.end(), order_gen);
+                for (size_t i : active) {
+                    vector<int> dist;
+                    if (counters) counters->start();
+                    double t = measure_time([&]() { dist = variants[i].run(graph, &pool[i]); });
+                    if (counters && round >= opt.warmup) counter_samples[i].push_back(counters->stop());
+                    if (round >= opt.warmup) samples[i].push_back(t);
+
+                    if (!checked[i]) {
+                        checked[i] = 1;
+                        correct[i] = dist == reference;
+                    }
                 }
             }
+
+            for (size_t i = 0; i < variants.size(); i++) {
+                if (samples[i].empty()) continue;
+                pooled[i].insert(pooled[i].end(), samples[i].begin(), samples[i].end());
+
+                SampleStats st = summarize(samples[i]);
+                PerfCounters::Values cm;
+                for (int e = 0; e < PerfCounters::COUNT; e++) cm[e] = counter_median(counter_samples[i], e);
+                double ipc = (cm[PerfCounters::CYCLES] > 0 && cm[PerfCounters::INSTRUCTIONS] >= 0)
+                           ? cm[PerfCounters::INSTRUCTIONS] / cm[PerfCounters::CYCLES] : -1.0;
+
+                cout << "   " << left << setw(20) << variants[i].name << right
+                     << "median " << setw(9) << st.median << " ms   min " << setw(9) << st.min
+                     << "   p90 " << setw(9) << st.p90 << "   sd " << setw(7) << st.stddev;
+                if (ipc >= 0) cout << "   IPC " << ipc;
+                if (cm[PerfCounters::LLC_MISSES] >= 0) cout << "   LLC miss " << (long long)cm[PerfCounters::LLC_MISSES];
+                if (!correct[i]) cout << "   WRONG DISTANCES";
+                cout << endl;
+                if (!correct[i]) wrong.push_back(variants[i].name + " @ " + opt.family + " seed " + to_string(seed));
+
+                stats_csv << opt.family << "," << seed << "," << graph.V << "," << graph.numEdges() << ","
+                          << density << "," << variants[i].name << "," << st.n << ","
+                          << st.min << "," << st.median << "," << st.mean << "," << st.p90 << ","
+                          << st.p99 << "," << st.max << "," << st.stddev;
+                for (int e = 0; e < PerfCounters::COUNT; e++) {
+                    stats_csv << ",";
+                    if (cm[e] >= 0) stats_csv << (long long)cm[e];
+                }
+                stats_csv << ",";
+                if (ipc >= 0) stats_csv << ipc;
+                stats_csv << "," << (correct[i] ? "ok" : "mismatch") << "\n";
+
+                json_rows << (first_row ? "" : ",") << "\n    {\"family\": \"" << opt.family
+                          << "\", \"seed\": " << seed << ", \"V\": " << graph.V
+                          << ", \"E\": " << graph.numEdges() << ", \"density\": " << density
+                          << ", \"variant\": \"" << variants[i].name << "\", \"reps\": " << st.n
+                          << ", \"min_ms\": " << st.min << ", \"median_ms\": " << st.median
+                          << ", \"mean_ms\": " << st.mean << ", \"p90_ms\": " << st.p90
+                          << ", \"p99_ms\": " << st.p99 << ", \"max_ms\": " << st.max
+                          << ", \"stddev_ms\": " << st.stddev
+                          << ", \"verified\": " << (correct[i] ? "true" : "false") << ", \"samples_ms\": [";
+                for (size_t k = 0; k < samples[i].size(); k++) json_rows << (k ? ", " : "") << samples[i][k];
+                json_rows << "], \"counters\": {";
+                bool first_counter = true;
+                for (int e = 0; e < PerfCounters::COUNT; e++) {
+                    if (cm[e] < 0) continue;
+                    json_rows << (first_counter ? "" : ", ") << "\"" << PerfCounters::name(e) << "\": " << (long long)cm[e];
+                    first_counter = false;
+                }
+                if (ipc >= 0) json_rows << (first_counter ? "" : ", ") << "\"IPC\": " << ipc;
+                json_rows << "}";
+
+                if (variants[i].structure) {
+                    Opt::PairingCounters pc;
+                    variants[i].structure(graph, &pc);
+                    uint64_t ops = pc.inserts + pc.deleteMins + pc.decreaseKeys;
+                    double links_per_op = ops ? (double)pc.links / ops : 0.0;
+
+                    structure_csv << density << "," << seed << "," << variants[i].name << ","
+                                  << pc.inserts << "," << pc.deleteMins << "," << pc.decreaseKeys << ","
+                                  << pc.cuts << "," << pc.links << "," << links_per_op << ","
+                                  << pc.combines << "," << pc.avgCombine() << "," << pc.maxCombine << ","
+                                  << pc.depthSamples << "," << pc.avgDepth() << "," << pc.maxDepth << ","
+                                  << histogram(pc.combineHist) << "," << histogram(pc.depthHist) << "\n";
+
+                    json_rows << ", \"structure\": {\"inserts\": " << pc.inserts
+                              << ", \"delete_mins\": " << pc.deleteMins << ", \"decrease_keys\": " << pc.decreaseKeys
+                              << ", \"cuts\": " << pc.cuts << ", \"links\": " << pc.links
+                              << ", \"combines\": " << pc.combines << ", \"avg_combine_len\": " << pc.avgCombine()
+                              << ", \"max_combine_len\": " << pc.maxCombine
+                              << ", \"avg_depth\": " << pc.avgDepth() << ", \"max_depth\": " << pc.maxDepth
+                              << ", \"combine_hist\": \"" << histogram(pc.combineHist)
+                              << "\", \"depth_hist\": \"" << histogram(pc.depthHist) << "\"}";
+                }
+                json_rows << "}";
+                first_row = false;
+
+                if (uses_pool(variants[i].name)) {
+                    pool_csv << density << "," << seed << "," << variants[i].name << ","
+                             << pool[i].live << "," << pool[i].peak << ","
+                             << pool[i].blocks << "," << pool[i].bytesReserved << "\n";
+                }
+            }
+        }
+
+        csv << density;
+        for (size_t i = 0; i < variants.size(); i++) {
+            csv << ",";
+            if (!pooled[i].empty()) csv << summarize(pooled[i]).median;
+        }
+        csv << "\n";
+    }
+
+    ofstream json(opt.out + ".json");
+    json << fixed << setprecision(4);
+    json << "{\n  \"host\": {\"compiler\": \"" << json_escape(host.compiler)
+         << "\", \"flags\": \"" << json_escape(host.flags)
+         << "\", \"hostname\": \"" << json_escape(host.hostname)
+         << "\", \"os\": \"" << json_escape(host.os)
+         << "\", \"cpu\": \"" << json_escape(host.cpu)
+         << "\", \"hardware_threads\": " << host.hardwareThreads
+         << ", \"llc_bytes\": " << host.llcBytes
+         << ", \"simd_kernel\": \"" << simdKernelName(simdBestKernel()) << "\""
+         << ", \"pinned_cpu\": " << (pinned ? opt.pinCpu : -1)
+         << ", \"hardware_counters\": " << (counters ? "true" : "false")
+         << ", \"timestamp\": \"" << host.timestamp << "\"},\n";
+    json << "  \"options\": {\"family\": \"" << opt.family
+         << "\", \"graph\": \"" << json_escape(opt.graphPath)
+         << "\", \"V\": " << opt.V << ", \"reps\": " << opt.reps << ", \"warmup\": " << opt.warmup
+         << ", \"order_seed\": " << opt.orderSeed << "},\n";
+    json << "  \"results\": [" << json_rows.str() << "\n  ]\n}\n";
+
+    cout << "Benchmark finished! Data saved to '" << opt.out << ".csv', '" << opt.out << "_stats.csv', '"
+         << opt.out << ".json', 'pool_stats.csv' and 'pairing_stats.csv'" << endl;
+
+    if (!wrong.empty()) {
+        cerr << "Error: distances differ from Std_PQ:";
+        for (const string &w : wrong) cerr << "\n   " << w;
+        cerr << endl;
+        return 1;
+    }
+    return 0;
+}
+
+// record the heap operations of one dijkstra_pairing run
+// usage: ./benchmark record <out.trace> [V density | graph file]
+void run_record(const string &path, int argc, char *argv[]) {
+    Graph graph;
+    if (argc == 1) graph = load_graph(argv[0]);
+    else graph = generate_graph(argc >= 1 ? atoi(argv[0]) : V_FIXED, argc >= 2 ? atof(argv[1]) : 20.0);
+
+    TraceWriter writer(path);
+    double t = measure_time([&]() { dijkstra_pairing<Opt::TwoPass, true>(graph, nullptr, &writer); });
+    writer.close();
+
+    cout << "Recorded " << writer.records() << " operations (V = " << graph.V << ", E = " << graph.numEdges()
+         << ", " << fixed << setprecision(2) << t << " ms with recording) to '" << path << "'" << endl;
+}
+
+// replay adapters: Heap, Handle, push / decrease / pop on TraceItem
+template <typename Pairing>
+struct ReplayOptPairing {
+    using Heap = Opt::PairingHeap<TraceItem, Pairing>;
+    using Handle = Opt::Node<TraceItem>*;
+    static Handle push(Heap &h, const TraceItem &x) { return h.insert(x); }
+    static void decrease(Heap &h, Handle n, const TraceItem &x) { h.decreaseKey(n, x); }
+    static int32_t pop(Heap &h) { return h.deleteMin().key; }
+};
+
+// FibonacciHeap / RankPairingHeap (node handles, PairingHeap API)
+template <typename H>
+struct ReplayNodeHeap {
+    using Heap = H;
+    using Handle = decltype(std::declval<Heap&>().insert(TraceItem{}));
+    static Handle push(Heap &h, const TraceItem &x) { return h.insert(x); }
+    static void decrease(Heap &h, Handle n, const TraceItem &x) { h.decreaseKey(n, x); }
+    static int32_t pop(Heap &h) { return h.deleteMin().key; }
+};
+
+struct ReplayOriginPairing {
+    using Heap = Origin::PairingHeap_NO<TraceItem>;
+    using Handle = Origin::Node<TraceItem>*;
+    static Handle push(Heap &h, const TraceItem &x) { return h.insert(x); }
+    static void decrease(Heap &h, Handle n, const TraceItem &x) { h.decreaseKey(n, x); }
+    static int32_t pop(Heap &h) { return h.deleteMin().key; }
+};
+
+struct ReplayCompactPairing {
+    using Heap = Opt::CompactPairingHeap<TraceItem>;
+    using Handle = Heap::Handle;
+    static Handle push(Heap &h, const TraceItem &x) { return h.insert(x); }
+    static void decrease(Heap &h, Handle n, const TraceItem &x) { h.decreaseKey(n, x); }
+    static int32_t pop(Heap &h) { return h.deleteMin().key; }
+};
+
+template <int D>
+struct ReplayDary {
+    using Heap = DaryHeap<TraceItem, D>;
+    using Handle = typename Heap::Handle;
+    static Handle push(Heap &h, const TraceItem &x) { return h.push(x); }
+    static void decrease(Heap &h, Handle n, const TraceItem &x) { h.decreaseKey(n, x); }
+    static int32_t pop(Heap &h) { int32_t k = h.top().key; h.pop(); return k; }
+};
+
+// monotone traces with non-negative keys only (RadixHeap throws otherwise)
+struct ReplayRadix {
+    using Heap = Opt::RadixHeap<uint32_t>;
+    using Handle = Heap::Handle;
+    static Handle push(Heap &h, const TraceItem &x) {
+        if (x.key < 0) throw runtime_error("RadixHeap: negative key in trace");
+        return h.insert(x.key, x.id);
+    }
+    static void decrease(Heap &h, Handle n, const TraceItem &x) { h.decreaseKey(n, x.key); }
+    static int32_t pop(Heap &h) { int32_t k = (int32_t)h.minKey(); h.deleteMin(); return k; }
+};
+
+struct ReplayBinary {
+    using Heap = BinaryHeap<TraceItem>;
+    static void push(Heap &h, const TraceItem &x) { h.push(x); }
+    static TraceItem pop(Heap &h) { TraceItem x = h.top(); h.pop(); return x; }
+};
+
+struct ReplayStd {
+    using Heap = priority_queue<TraceItem, vector<TraceItem>, greater<TraceItem>>;
+    static void push(Heap &h, const TraceItem &x) { h.push(x); }
+    static TraceItem pop(Heap &h) { TraceItem x = h.top(); h.pop(); return x; }
+};
+
+// replay one trace through every heap, check each against the recorded deleteMin keys
+// usage: ./benchmark replay <file.trace> [reps]
+void run_replay(const string &path, int reps) {
+    Trace trace = map_trace(path);
+    uint64_t ops[3] = {0, 0, 0};
+    for (uint64_t i = 0; i < trace.count; i++) ops[trace.records[i].op() & 3]++;
+
+    cout << "Replaying '" << path << "': " << trace.count << " operations (" << ops[TRACE_INSERT] << " insert, "
+         << ops[TRACE_DECREASE_KEY] << " decreaseKey, " << ops[TRACE_DELETE_MIN] << " deleteMin), reps = "
+         << reps << endl;
+
+    vector<pair<string, function<void(const Trace&, vector<int32_t>&)>>> heaps = {
+        {"Pairing_OPT",        replay_addressable<ReplayOptPairing<Opt::TwoPass>>},
+        {"Pairing_MultiPass",  replay_addressable<ReplayOptPairing<Opt::MultiPass>>},
+        {"Pairing_F2B",        replay_addressable<ReplayOptPairing<Opt::FrontToBack>>},
+        {"Pairing_AuxTwoPass", replay_addressable<ReplayOptPairing<Opt::AuxTwoPass>>},
+        {"Pairing_NoPool",     replay_addressable<ReplayOriginPairing>},
+        {"Pairing_Compact",    replay_addressable<ReplayCompactPairing>},
+        {"Fibonacci",          replay_addressable<ReplayNodeHeap<Opt::FibonacciHeap<TraceItem>>>},
+        {"Rank_Pairing",       replay_addressable<ReplayNodeHeap<Opt::RankPairingHeap<TraceItem>>>},
+        {"Dary2",              replay_addressable<ReplayDary<2>>},
+        {"Dary4",              replay_addressable<ReplayDary<4>>},
+        {"Dary8",              replay_addressable<ReplayDary<8>>},
+        {"Radix",              replay_addressable<ReplayRadix>},
+        {"Binary",             replay_lazy<ReplayBinary>},
+        {"Std_PQ",             replay_lazy<ReplayStd>},
+    };
+
+    ofstream csv("replay_result.csv");
+    csv << "Heap,Ops,Reps,Median(ms),Min(ms),P90(ms),ns/op,Check\n";
+    cout << fixed << setprecision(2);
+
+    for (auto &h : heaps) {
+        ReplayResult r = replay_timed(h.first, trace, reps, h.second);
+        cout << "   " << left << setw(20) << h.first << right;
+        if (r.ms.empty()) {
+            cout << "skipped: " << r.note << endl;
+            csv << h.first << "," << trace.count << ",0,,,,,skipped\n";
+            continue;
+        }
+        SampleStats st = summarize(r.ms);
+        double ns_op = st.median * 1e6 / max<uint64_t>(1, trace.count);
+        cout << "median " << setw(9) << st.median << " ms   min " << setw(9) << st.min
+             << "   " << setw(7) << ns_op << " ns/op   " << (r.ok ? "OK" : "MISMATCH: " + r.note) << endl;
+        csv << h.first << "," << trace.count << "," << st.n << "," << st.median << "," << st.min << ","
+            << st.p90 << "," << ns_op << "," << (r.ok ? "ok" : "mismatch") << "\n";
+    }
+    cout << "Data saved to 'replay_result.csv'" << endl;
+}
+
+// delta-stepping thread-scaling sweep, checked against Std_PQ
+// usage: ./benchmark delta [max_threads] [delta]
+void run_delta_benchmark(int max_threads, int delta) {
+    const double density = 10.0;
+    Graph graph = generate_graph(V_FIXED, density);
+
+    if (delta <= 0) {
+        // Meyer & Sanders: delta ~ max weight / average degree
+        int max_w = 1;
+        for (long long e = 0; e < graph.numEdges(); e++) max_w = max(max_w, graph.weight[e]);
+        double avg_deg = max(1.0, (double)graph.numEdges() / graph.V);
+        delta = max(1, (int)(max_w / avg_deg));
+    }
+
+    vector<int> thread_counts;
+    for (int t = 1; t < max_threads; t *= 2) thread_counts.push_back(t);
+    thread_counts.push_back(max_threads);
+
+    vector<int> reference = dijkstra<StdQueue>(graph);
+    double time_std = measure_time([&]() { dijkstra<StdQueue>(graph); });
+
+    ofstream csv("delta_result.csv");
+    csv << "Threads,Delta,DeltaStepping(ms),Std_PQ(ms),Speedup\n";
+
+    cout << "Delta-Stepping (V = " << V_FIXED << ", D = " << density << "%, delta = " << delta << ")" << endl;
+    cout << fixed << setprecision(2);
+    cout << "   Std_PQ:          " << time_std << " ms" << endl;
+
+    for (int threads : thread_counts) {
+        DeltaStepping engine(graph, delta, threads);
+
+        vector<int> dist = engine.run(0); // warm up + verify
+        if (dist != reference) {
+            cout << "   MISMATCH with Std_PQ at " << threads << " threads" << endl;
         }
+
+        double t = measure_time([&]() { engine.run(0); });
+        cout << "   " << setw(3) << threads << " threads:     " << t << " ms"
+             << " (x" << time_std / t << " vs Std_PQ)" << endl;
+        csv << threads << "," << delta << "," << t << "," << time_std << "," << time_std / t << "\n";
     }
+
+    cout << "Data saved to 'delta_result.csv'" << endl;
 }
 
-// min-pairing-heap
-void dijkstra_pairing(int V, const vector<vector<Edge>> &adj) {
+// one point-to-point query the way the dijkstra_* variants run: fresh dist / handles / heap
+// (and so a fresh MemoryPool) per call, stops when target is settled
+int fresh_query(const Graph &g, int source, int target) {
     Opt::PairingHeap<State> pq;
-    vector<int> dist(V, INF);
-    // handles => O(1)
-    vector<Opt::Node<State> *> handles(V, nullptr);
-    
-    dist[0] = 0;
-    handles[0] = pq.insert({0, 0});
-    
+    vector<int> dist(g.V, INF);
+    vector<Opt::Node<State> *> handles(g.V, nullptr);
+    vector<char> done(g.V, 0);
+
+    dist[source] = 0;
+    handles[source] = pq.insert({0, source});
+
     while (!pq.empty()) {
-        State top = pq.getMin();
-        pq.deleteMin();
+        int u = pq.deleteMin().vertex;
+        done[u] = 1;
+        if (u == target) break;
 
-        int u = top.vertex;
-        handles[u] = nullptr;
-        
-        for (const auto &edge : adj[u]) {
-            int v = edge.to;
-            int weight = edge.weight;
-            int new_dist = dist[u] + weight;
-            
-            if (new_dist < dist[v]) {
-                dist[v] = new_dist;
-                if (handles[v] == nullptr) {
-                    // not in Heap -> Insert
-                    handles[v] = pq.insert({new_dist, v});
-                } else {
-                    // in Heap -> Decrease Key
-                    pq.decreaseKey(handles[v], {new_dist, v});
-                }
-            }
+        for (long long e = g.offsets[u]; e < g.offsets[u + 1]; e++) {
+            int v = g.to[e];
+            int new_dist = dist[u] + g.weight[e];
+            if (done[v] || new_dist >= dist[v]) continue;
+
+            dist[v] = new_dist;
+            if (handles[v]) pq.decreaseKey(handles[v], {new_dist, v});
+            else handles[v] = pq.insert({new_dist, v});
         }
     }
+    return dist[target];
 }
 
-template<typename Func>
-double measure_time(Func func) {
-    auto start = chrono::high_resolution_clock::now();
-    func();
-    auto end = chrono::high_resolution_clock::now();
-    
-    // return (ms)
-    return chrono::duration<double, milli>(end - start).count();
+// queries per second on random (source, target) pairs of a road-like grid:
+//   Fresh        - fresh_query per pair (O(V) setup every time)
+//   Engine       - QueryEngine::distance per pair (epoch reset, persistent heap / pool)
+//   Engine_Batch - QueryEngine::distances on the whole batch (one search per distinct source)
+// workloads:
+//   local       - target within RADIUS rows / columns of the source (short queries, setup-bound)
+//   one_to_many - local, 16 targets per source
+//   random      - source and target anywhere (long queries, search-bound; queries / 16 of them)
+// usage: ./benchmark queries [V] [queries]
+void run_query_benchmark(int V, int queries) {
+    const int FAN_OUT = 16;
+    const int RADIUS = 32;
+    Graph g = generate_grid(V);
+
+    int cols = 1; // same layout as generate_grid
+    while ((long long)cols * cols < g.V) cols++;
+
+    mt19937 gen(7);
+    uniform_int_distribution<> pick(0, g.V - 1);
+    uniform_int_distribution<> step(-RADIUS, RADIUS);
+    auto near = [&](int s) {
+        int r = max(0, s / cols + step(gen));
+        int c = min(cols - 1, max(0, s % cols + step(gen)));
+        return min(g.V - 1, r * cols + c);
+    };
+
+    struct Workload { const char *name; vector<pair<int, int>> pairs; };
+    vector<Workload> workloads(3);
+    workloads[0].name = "local";
+    workloads[1].name = "one_to_many";
+    workloads[2].name = "random";
+    for (int i = 0; i < queries; i++) {
+        int s = pick(gen);
+        workloads[0].pairs.push_back({s, near(s)});
+    }
+    for (int i = 0; i < queries; i += FAN_OUT) {
+        int s = pick(gen);
+        for (int k = 0; k < FAN_OUT && i + k < queries; k++) workloads[1].pairs.push_back({s, near(s)});
+    }
+    for (int i = 0; i < max(1, queries / FAN_OUT); i++) workloads[2].pairs.push_back({pick(gen), pick(gen)});
+
+    ofstream csv("query_result.csv");
+    csv << "Workload,Queries,Fresh(qps),Engine(qps),Engine_Batch(qps),Settled_Per_Query\n";
+
+    cout << "Point-to-point queries (grid, V = " << g.V << ", E = " << g.numEdges() << ")" << endl;
+    cout << fixed << setprecision(1);
+
+    QueryEngine engine(g);
+    for (const Workload &w : workloads) {
+        const size_t n = w.pairs.size();
+        vector<int> fresh(n), single(n), batch;
+        size_t settled = 0;
+
+        double t_fresh = measure_time([&]() {
+            for (size_t i = 0; i < n; i++) fresh[i] = fresh_query(g, w.pairs[i].first, w.pairs[i].second);
+        });
+        double t_single = measure_time([&]() {
+            for (size_t i = 0; i < n; i++) {
+                single[i] = engine.distance(w.pairs[i].first, w.pairs[i].second);
+                settled += engine.settled();
+            }
+        });
+        double t_batch = measure_time([&]() { engine.distances(w.pairs, batch); });
+
+        if (single != fresh || batch != fresh) {
+            cout << "   MISMATCH between fresh and engine answers (" << w.name << ")" << endl;
+        }
+
+        double qps_fresh = n / (t_fresh / 1000.0);
+        double qps_single = n / (t_single / 1000.0);
+        double qps_batch = n / (t_batch / 1000.0);
+        cout << "   " << w.name << " (" << n << " queries)"
+             << "\n      Fresh:        " << qps_fresh << " q/s"
+             << "\n      Engine:       " << qps_single << " q/s (x" << qps_single / qps_fresh << ")"
+             << "\n      Engine batch: " << qps_batch << " q/s (x" << qps_batch / qps_fresh << ")"
+             << "\n      settled / query: " << (double)settled / n << endl;
+
+        csv << w.name << "," << n << "," << qps_fresh << "," << qps_single << "," << qps_batch << ","
+            << (double)settled / n << "\n";
+    }
+
+    cout << "Data saved to 'query_result.csv'" << endl;
 }
 
 int main(int argc, char* argv[]) {  
-    if (argc > 1) {
+    if (argc > 1 && string(argv[1]) == "teardown") {
+        run_teardown_benchmark();
+        return 0;
+    }
+
+    if (argc > 1 && string(argv[1]) == "bulk") {
+        run_bulk_benchmark();
+        return 0;
+    }
+
+    if (argc > 1 && string(argv[1]) == "payload") {
+        run_payload_benchmark(argc > 2 ? atoi(argv[2]) : V_FIXED, argc > 3 ? atof(argv[3]) : 20.0);
+        return 0;
+    }
+
+    if (argc > 1 && (string(argv[1]) == "prefetch" || string(argv[1]) == "hugepages")) {
+        run_locality_benchmark(argv[1], argc > 2 ? atoi(argv[2]) : 8000000, argc > 3 ? atof(argv[3]) : 8.0,
+                               argc > 4 ? max(1, atoi(argv[4])) : 3);
+        return 0;
+    }
+
+    if (argc > 1 && string(argv[1]) == "queries") {
+        run_query_benchmark(argc > 2 ? atoi(argv[2]) : 1000000, argc > 3 ? max(1, atoi(argv[3])) : 2000);
+        return 0;
+    }
+
+    if (argc > 1 && string(argv[1]) == "multiqueue") {
+        int hw = max(1u, thread::hardware_concurrency());
+        int max_threads = argc > 2 ? atoi(argv[2]) : hw;
+        run_multiqueue_benchmark(max(1, max_threads));
+        return 0;
+    }
+
+    if (argc > 1 && string(argv[1]) == "delta") {
+        int hw = max(1u, thread::hardware_concurrency());
+        int max_threads = argc > 2 ? atoi(argv[2]) : hw;
+        int delta = argc > 3 ? atoi(argv[3]) : 0; // 0 = heuristic
+        run_delta_benchmark(max(1, max_threads), delta);
+        return 0;
+    }
+
+    if (argc > 1 && (string(argv[1]) == "record" || string(argv[1]) == "replay")) {
+        if (argc < 3) {
+            cout << "Usage: " << argv[0] << " record <out.trace> [V density | graph file]" << endl
+                 << "       " << argv[0] << " replay <file.trace> [reps]" << endl;
+            return 1;
+        }
+        try {
+            if (string(argv[1]) == "record") run_record(argv[2], argc - 3, argv + 3);
+            else run_replay(argv[2], argc > 3 ? max(1, atoi(argv[3])) : 5);
+        } catch (const exception &e) {
+            cerr << "Error: " << e.what() << endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    if (argc > 1 && string(argv[1]) == "graph") {
+        // ./benchmark graph <file> [options] = the harness on one graph file
+        if (argc < 3) {
+            cout << "Usage: " << argv[0] << " graph <file.gr | file.bin> [options]" << endl;
+            return 1;
+        }
+        BenchOptions opt;
+        opt.family = "file";
+        opt.graphPath = argv[2];
+        opt.out = "graph_result";
+        string error;
+        if (!parse_options(argc, argv, 3, opt, error)) {
+            if (!error.empty()) cerr << "Error: " << error << endl;
+            print_usage(argv[0]);
+            return 1;
+        }
+        try {
+            return run_sweep(opt);
+        } catch (const exception &e) {
+            cerr << "Error: " << e.what() << endl;
+            return 1;
+        }
+    }
+
+    if (argc > 1 && string(argv[1]).compare(0, 2, "--") != 0 && string(argv[1]) != "-h") {
         // --- Perf / Valgrind 測試模式 ---
         string mode = argv[1];
         
         // 為了 Perf 分析，使用較高密度與規模
         int V_Perf = 5000; 
         double D_Perf = 20.0;
+
+        vector<Variant> variants = all_variants();
+        auto it = find_if(variants.begin(), variants.end(), [&](const Variant &v) { return v.mode == mode; });
+        if (it == variants.end()) {
+            cout << "Unknown mode. Use: teardown, bulk, payload, prefetch, hugepages, queries, multiqueue, delta, graph, record, replay, or one of:";
+            for (const Variant &v : variants) cout << " " << v.mode;
+            cout << endl;
+            return 1;
+        }
         
         cout << "Perf Mode: Running " << mode << " (V=" << V_Perf << ", D=" << D_Perf << "%)" << endl;
         
-        auto adj = generate_graph(V_Perf, D_Perf);
-
-        if (mode == "brutal") {
-            dijkstra_brutal(V_Perf, adj);
-        } else if (mode == "std") {
-            dijkstra_std(V_Perf, adj);
-        } else if (mode == "binary") {
-            dijkstra_binary(V_Perf, adj);
-        } else if (mode == "pairing_no") {
-            dijkstra_pairing_no(V_Perf, adj);
-        } else if (mode == "pairing") {
-            dijkstra_pairing(V_Perf, adj);
-        } else {
-            cout << "Unknown mode. Use: brutal, std, binary, pairing_no, pairing" << endl;
+        Graph graph = generate_graph(V_Perf, D_Perf);
+
+        PerfCounters counters;
+        counters.start();
+        double t = measure_time([&]() { it->run(graph, nullptr); });
+        PerfCounters::Values v = counters.stop();
+
+        cout << "   time: " << fixed << setprecision(2) << t << " ms" << endl;
+        for (int e = 0; e < PerfCounters::COUNT; e++) {
+            if (v[e] >= 0) cout << "   " << left << setw(14) << PerfCounters::name(e) << right << (long long)v[e] << endl;
         }
+        if (!counters.available()) cout << "   (hardware counters unavailable: " << counters.error() << ")" << endl;
         
         return 0;
     }
     
-    // --- 完整 Benchmark 模式 ---
-    vector<double> densities = {0.1, 0.5, 1.0, 2.5, 5.0, 10.0, 20.0, 30.0, 40.0, 50.0, 60.0, 70.0, 80.0, 90.0, 100.0};
-
-    ofstream csv("benchmark_result.csv");
-    // 更新 CSV Header
-    csv << "Density(%),Linear(ms),Std_PQ(ms),Binary(ms),Pairing_NoPool(ms),Pairing_OPT(ms)\n"; 
-    
-    cout << "Starting Benchmark (V = " << V_FIXED << ")..." << endl;
-    cout << fixed << setprecision(2);
-
-    for (double density : densities) {
-        cout << "Running Density: " << density << "% ... " << flush;
-        
-        auto adj = generate_graph(V_FIXED, density);
-        
-        // Warm up
-        dijkstra_brutal(V_FIXED, adj);
-        dijkstra_std(V_FIXED, adj); 
-        dijkstra_binary(V_FIXED, adj);
-        dijkstra_pairing_no(V_FIXED, adj);
-        dijkstra_pairing(V_FIXED, adj);
-        
-        double time_brutal = measure_time([&]() { dijkstra_brutal(V_FIXED, adj); });
-        double time_std    = measure_time([&]() { dijkstra_std(V_FIXED, adj); });
-        double time_binary = measure_time([&]() { dijkstra_binary(V_FIXED, adj); });
-        double time_pair_n = measure_time([&]() { dijkstra_pairing_no(V_FIXED, adj); });
-        double time_pair_p = measure_time([&]() { dijkstra_pairing(V_FIXED, adj); });
-        
-        cout << "\n   Linear:     " << time_brutal << " ms"
-             << "\n   Std_PQ:     " << time_std << " ms"
-             << "\n   Binary:     " << time_binary << " ms"
-             << "\n   Pairing_NO: " << time_pair_n << " ms"
-             << "\n   Pairing_OPT: " << time_pair_p << " ms" << endl;
-
-        csv << density << "," 
-            << time_brutal << "," 
-            << time_std << "," 
-            << time_binary << "," 
-            << time_pair_n << "," 
-            << time_pair_p << "\n";
+    // --- 完整 Benchmark 模式 (參數見 harness.hpp) ---
+    BenchOptions opt;
+    opt.V = V_FIXED;
+    string error;
+    if (!parse_options(argc, argv, 1, opt, error)) {
+        if (!error.empty()) cerr << "Error: " << error << endl;
+        print_usage(argv[0]);
+        return 1;
     }
-    
-    cout << "Benchmark finished! Data saved to 'benchmark_result.csv'" << endl;
-    return 0;
-}
\ No newline at end of file
+    try {
+        return run_sweep(opt);
+    } catch (const exception &e) {
+        cerr << "Error: " << e.what() << endl;
+        return 1;
+    }
+}
@@ -0,0 +1,252 @@
+#ifndef DELTA_STEPPING_HPP
+#define DELTA_STEPPING_HPP
+
+// Parallel delta-stepping SSSP (Meyer & Sanders) on the CSR Graph.
+//   - vertices live in buckets of width delta (bucket = dist / delta)
+//   - the current bucket is emptied in rounds of parallel light-edge (w <= delta) relaxation,
+//     then all vertices settled in it relax their heavy edges (w > delta) once, in parallel
+//   - dist[] is updated with an atomic min (CAS loop); a successful update is queued in the
+//     thread's outbox and merged into the global buckets between rounds
+// Threads are created once per engine and reused for every round of every query.
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+#include "graph.hpp"
+
+// fixed team of worker threads; run(fn) calls fn(tid) on every member (tid 0 = caller) and waits
+class ThreadTeam {
+private:
+    std::vector<std::thread> workers;
+    std::mutex mtx;
+    std::condition_variable startCv, doneCv;
+    const std::function<void(int)> *job = nullptr;
+    unsigned long long generation = 0;
+    int pending = 0;
+    bool stopping = false;
+
+    void workerLoop(int tid) {
+        unsigned long long seen = 0;
+        while (true) {
+            const std::function<void(int)> *fn;
+            {
+                std::unique_lock<std::mutex> lock(mtx);
+                startCv.wait(lock, [&]() { return stopping || generation != seen; });
+                if (stopping) return;
+                seen = generation;
+                fn = job;
+            }
+
+            (*fn)(tid);
+
+            std::lock_guard<std::mutex> lock(mtx);
+            if (--pending == 0) doneCv.notify_one();
+        }
+    }
+
+public:
+    explicit ThreadTeam(int threads) {
+        if (threads < 1) throw std::invalid_argument("ThreadTeam: need at least one thread");
+        for (int t = 1; t < threads; t++) workers.emplace_back(&ThreadTeam::workerLoop, this, t);
+    }
+
+    ~ThreadTeam() {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            stopping = true;
+        }
+        startCv.notify_all();
+        for (auto &w : workers) w.join();
+    }
+
+    ThreadTeam(const ThreadTeam&) = delete;
+    ThreadTeam& operator=(const ThreadTeam&) = delete;
+
+    int size() const { return (int)workers.size() + 1; }
+
+    void run(const std::function<void(int)> &fn) {
+        if (workers.empty()) {
+            fn(0);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            job = &fn;
+            pending = (int)workers.size();
+            generation++;
+        }
+        startCv.notify_all();
+
+        fn(0);
+
+        std::unique_lock<std::mutex> lock(mtx);
+        doneCv.wait(lock, [&]() { return pending == 0; });
+    }
+};
+
+class DeltaStepping {
+public:
+    // same "unreached" value as the dijkstra_* variants
+    static const int INF = 1000000000;
+
+private:
+    // light / heavy split of the input graph (CSR each), built once per engine
+    struct Half {
+        std::vector<long long> offsets;
+        std::vector<int> to;
+        std::vector<int> weight;
+    };
+
+    int V;
+    int delta;
+    Half light, heavy;
+
+    ThreadTeam team;
+
+    std::vector<std::atomic<int>> dist;
+    std::vector<std::vector<int>> buckets;
+    std::vector<std::vector<int>> outbox; // per thread: vertices whose dist went down
+    std::vector<int> frontierMark;        // round id that last took the vertex (dedupe)
+    std::vector<int> settledMark;         // bucket id + 1 that last settled the vertex
+
+    static const int CHUNK = 64;
+
+    void split(const Graph &g) {
+        light.offsets.assign(V + 1, 0);
+        heavy.offsets.assign(V + 1, 0);
+        for (int u = 0; u < V; u++) {
+            for (long long e = g.offsets[u]; e < g.offsets[u + 1]; e++) {
+                if (g.weight[e] <= delta) light.offsets[u + 1]++;
+                else heavy.offsets[u + 1]++;
+            }
+        }
+        for (int u = 0; u < V; u++) {
+            light.offsets[u + 1] += light.offsets[u];
+            heavy.offsets[u + 1] += heavy.offsets[u];
+        }
+        light.to.resize(light.offsets[V]);
+        light.weight.resize(light.offsets[V]);
+        heavy.to.resize(heavy.offsets[V]);
+        heavy.weight.resize(heavy.offsets[V]);
+
+        for (int u = 0; u < V; u++) {
+            long long li = light.offsets[u], hi = heavy.offsets[u];
+            for (long long e = g.offsets[u]; e < g.offsets[u + 1]; e++) {
+                Half &h = (g.weight[e] <= delta) ? light : heavy;
+                long long &i = (g.weight[e] <= delta) ? li : hi;
+                h.to[i] = g.to[e];
+                h.weight[i] = g.weight[e];
+                i++;
+            }
+        }
+    }
+
+    // atomic min; true when new_dist was stored
+    bool relax(int v, int new_dist) {
+        int old = dist[v].load(std::memory_order_relaxed);
+        while (new_dist < old) {
+            if (dist[v].compare_exchange_weak(old, new_dist, std::memory_order_relaxed)) return true;
+        }
+        return false;
+    }
+
+    // relax edges of `half` for every vertex of `items`, chunks handed out dynamically
+    void relaxAll(const std::vector<int> &items, const Half &half) {
+        std::atomic<std::size_t> next(0);
+        const std::size_t n = items.size();
+
+        team.run([&](int tid) {
+            std::vector<int> &out = outbox[tid];
+            while (true) {
+                std::size_t begin = next.fetch_add(CHUNK, std::memory_order_relaxed);
+                if (begin >= n) break;
+                std::size_t end = std::min(begin + CHUNK, n);
+
+                for (std::size_t i = begin; i < end; i++) {
+                    int u = items[i];
+                    int du = dist[u].load(std::memory_order_relaxed);
+                    for (long long e = half.offsets[u]; e < half.offsets[u + 1]; e++) {
+                        if (relax(half.to[e], du + half.weight[e])) out.push_back(half.to[e]);
+                    }
+                }
+            }
+        });
+
+        // merge outboxes into the global buckets
+        for (auto &out : outbox) {
+            for (int v : out) {
+                std::size_t b = dist[v].load(std::memory_order_relaxed) / delta;
+                if (b >= buckets.size()) buckets.resize(b + 1);
+                buckets[b].push_back(v);
+            }
+            out.clear();
+        }
+    }
+
+public:
+    DeltaStepping(const Graph &g, int delta, int threads)
+        : V(g.V), delta(delta), team(threads), dist(g.V), outbox(threads),
+          frontierMark(g.V, -1), settledMark(g.V, 0) {
+        if (delta < 1) throw std::invalid_argument("DeltaStepping: delta must be >= 1");
+        split(g);
+    }
+
+    int threads() const { return team.size(); }
+    int bucketWidth() const { return delta; }
+
+    // shortest distances from source (INF = unreachable)
+    std::vector<int> run(int source) {
+        for (int v = 0; v < V; v++) dist[v].store(INF, std::memory_order_relaxed);
+        std::fill(frontierMark.begin(), frontierMark.end(), -1);
+        std::fill(settledMark.begin(), settledMark.end(), 0);
+        for (auto &b : buckets) b.clear();
+
+        dist[source].store(0, std::memory_order_relaxed);
+        if (buckets.empty()) buckets.resize(1);
+        buckets[0].push_back(source);
+
+        std::vector<int> frontier, settled;
+        int round = 0;
+
+        for (std::size_t cur = 0; cur < buckets.size(); cur++) {
+            if (buckets[cur].empty()) continue;
+            settled.clear();
+
+            // light rounds until the bucket stays empty
+            while (!buckets[cur].empty()) {
+                frontier.clear();
+                for (int u : buckets[cur]) {
+                    // skip stale entries (moved to a lower bucket) and duplicates of this round
+                    if ((std::size_t)(dist[u].load(std::memory_order_relaxed) / delta) != cur) continue;
+                    if (frontierMark[u] == round) continue;
+                    frontierMark[u] = round;
+                    frontier.push_back(u);
+
+                    if (settledMark[u] != (int)cur + 1) {
+                        settledMark[u] = (int)cur + 1;
+                        settled.push_back(u);
+                    }
+                }
+                buckets[cur].clear();
+                round++;
+
+                relaxAll(frontier, light);
+            }
+
+            // heavy edges once per settled vertex (they cannot land in the current bucket)
+            relaxAll(settled, heavy);
+        }
+
+        std::vector<int> result(V);
+        for (int v = 0; v < V; v++) result[v] = dist[v].load(std::memory_order_relaxed);
+        return result;
+    }
+};
+
+#endif
@@ -0,0 +1,214 @@
+#ifndef DIJKSTRA_HPP
+#define DIJKSTRA_HPP
+
+// One Dijkstra for every priority queue of the benchmark.
+//   QueueTraits<Queue> - how dijkstra talks to a queue of (dist, vertex) entries:
+//       addressable queues (insert returns a handle, decreaseKey(handle, entry) exists):
+//           Handle push(q, d, v), void decrease(q, h, d, v), Handle none()
+//       lazy queues (no decreaseKey): push(q, d, v) adds a new entry, stale ones are skipped
+//       both: int pop(q, d) removes the min, returns its vertex and writes its dist to d
+//   The default traits detect the API of element heaps ({dist, vertex} structs: State,
+//   FatState, ...): getMin() or top(), insert() or push(), deleteMin() or top() + pop(),
+//   NIL or a null handle. Key / value heaps (KeyedPairingHeap, RadixHeap, SimdDaryHeap) are specialized.
+//   dijkstra<Queue>(g, source) - everything is resolved at compile time, no virtual calls
+// G: any CSR graph with V, offsets, to and weight (see graph.hpp).
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../datastructure/optimize/keyed_pairing_heap.hpp"
+#include "../datastructure/optimize/radix_heap.hpp"
+#include "../baseline/simd_dary_heap.hpp"
+
+// same "unreached" value as benchmark.cpp's INF
+constexpr int DIJKSTRA_INF = 1000000000;
+
+namespace heap_detail {
+    template <typename Q, typename = void>
+    struct has_get_min : std::false_type {};
+    template <typename Q>
+    struct has_get_min<Q, std::void_t<decltype(std::declval<const Q&>().getMin())>> : std::true_type {};
+
+    // element type: what getMin() / top() shows
+    template <typename Q, bool = has_get_min<Q>::value>
+    struct element { using type = std::decay_t<decltype(std::declval<const Q&>().getMin())>; };
+    template <typename Q>
+    struct element<Q, false> { using type = std::decay_t<decltype(std::declval<const Q&>().top())>; };
+
+    template <typename Q, typename E, typename = void>
+    struct has_insert : std::false_type {};
+    template <typename Q, typename E>
+    struct has_insert<Q, E, std::void_t<decltype(std::declval<Q&>().insert(std::declval<const E&>()))>> : std::true_type {};
+
+    // handle type: what insert() / push() returns (void: no handles)
+    template <typename Q, typename E, bool = has_insert<Q, E>::value>
+    struct push_result { using type = decltype(std::declval<Q&>().insert(std::declval<const E&>())); };
+    template <typename Q, typename E>
+    struct push_result<Q, E, false> { using type = decltype(std::declval<Q&>().push(std::declval<const E&>())); };
+
+    template <typename Q, typename = void>
+    struct has_delete_min : std::false_type {};
+    template <typename Q>
+    struct has_delete_min<Q, std::void_t<decltype(std::declval<Q&>().deleteMin())>> : std::true_type {};
+
+    template <typename Q, typename H, typename E, typename = void>
+    struct has_decrease_key : std::false_type {};
+    template <typename Q, typename H, typename E>
+    struct has_decrease_key<Q, H, E, std::void_t<decltype(std::declval<Q&>().decreaseKey(std::declval<H>(), std::declval<const E&>()))>>
+        : std::true_type {};
+
+    template <typename Q, typename = void>
+    struct has_nil : std::false_type {};
+    template <typename Q>
+    struct has_nil<Q, std::void_t<decltype(Q::NIL)>> : std::true_type {};
+}
+
+template <typename Q, typename = void>
+struct QueueTraits {
+    using Elem = typename heap_detail::element<Q>::type;
+
+    static constexpr bool useInsert = heap_detail::has_insert<Q, Elem>::value;
+
+    using Handle = typename heap_detail::push_result<Q, Elem>::type;
+
+    static constexpr bool addressable =
+        !std::is_void<Handle>::value && heap_detail::has_decrease_key<Q, Handle, Elem>::value;
+
+    static Handle push(Q &q, int d, int v) {
+        if constexpr (useInsert) return q.insert(Elem{d, v});
+        else return q.push(Elem{d, v});
+    }
+
+    // template: Handle is void for lazy queues
+    template <typename H>
+    static void decrease(Q &q, H h, int d, int v) { q.decreaseKey(h, Elem{d, v}); }
+
+    static Handle none() {
+        if constexpr (heap_detail::has_nil<Q>::value) return Q::NIL;
+        else return Handle{};
+    }
+
+    static int pop(Q &q, int &d) {
+        if constexpr (heap_detail::has_delete_min<Q>::value) {
+            Elem e = q.deleteMin();
+            d = e.dist;
+            return e.vertex;
+        } else {
+            Elem e = q.top();
+            q.pop();
+            d = e.dist;
+            return e.vertex;
+        }
+    }
+};
+
+// int dist as the key, {dist, vertex, ...} payload
+// (key-only KeyedPairingHeap = CompactPairingHeap goes through the default traits)
+template <typename Payload, typename Compare, typename Pairing>
+struct QueueTraits<Opt::KeyedPairingHeap<int, Payload, Compare, Pairing>, std::enable_if_t<!std::is_void<Payload>::value>> {
+    using Q = Opt::KeyedPairingHeap<int, Payload, Compare, Pairing>;
+    using Handle = typename Q::Handle;
+    static constexpr bool addressable = true;
+
+    static Handle push(Q &q, int d, int v) { return q.insert(d, Payload{d, v}); }
+    static void decrease(Q &q, Handle h, int d, int) { q.decreaseKey(h, d); }
+    static Handle none() { return Q::NIL; }
+    static int pop(Q &q, int &d) {
+        d = q.minKey();
+        return q.deleteMin().vertex;
+    }
+};
+
+// monotone integer keys = dist, value = vertex
+template <typename T>
+struct QueueTraits<Opt::RadixHeap<T>> {
+    using Q = Opt::RadixHeap<T>;
+    using Handle = typename Q::Handle;
+    static constexpr bool addressable = true;
+
+    static Handle push(Q &q, int d, int v) { return q.insert(d, v); }
+    static void decrease(Q &q, Handle h, int d, int) { q.decreaseKey(h, d); }
+    static Handle none() { return Q::NIL; }
+    static int pop(Q &q, int &d) {
+        d = (int)q.minKey();
+        return (int)q.deleteMin();
+    }
+};
+
+// int32 dist = key, value = vertex (lazy: no decreaseKey)
+template <typename Value, int D>
+struct QueueTraits<SimdDaryHeap<Value, D>> {
+    using Q = SimdDaryHeap<Value, D>;
+    using Handle = void;
+    static constexpr bool addressable = false;
+
+    static void push(Q &q, int d, int v) { q.push(d, v); }
+    static int pop(Q &q, int &d) {
+        d = q.minKey();
+        return (int)q.deleteMin();
+    }
+};
+
+// shortest distances from source on q (left empty), DIJKSTRA_INF = unreachable
+//   addressable: one entry per vertex, decreaseKey on every improvement
+//   lazy:        a new entry per improvement, entries with d > dist[u] are skipped
+template <typename Queue, typename G>
+std::vector<int> dijkstra(const G &g, Queue &q, int source = 0) {
+    using Traits = QueueTraits<Queue>;
+    const int V = g.V;
+    std::vector<int> dist(V, DIJKSTRA_INF);
+    dist[source] = 0;
+
+    if constexpr (Traits::addressable) {
+        using Handle = typename Traits::Handle;
+        const Handle none = Traits::none();
+        std::vector<Handle> handles(V, none);
+        handles[source] = Traits::push(q, 0, source);
+
+        while (!q.empty()) {
+            int d;
+            int u = Traits::pop(q, d);
+            handles[u] = none;
+
+            for (long long e = g.offsets[u]; e < g.offsets[u + 1]; e++) {
+                int v = g.to[e];
+                int new_dist = dist[u] + g.weight[e];
+
+                if (new_dist < dist[v]) {
+                    dist[v] = new_dist;
+                    if (handles[v] == none) handles[v] = Traits::push(q, new_dist, v);
+                    else Traits::decrease(q, handles[v], new_dist, v);
+                }
+            }
+        }
+    } else {
+        Traits::push(q, 0, source);
+
+        while (!q.empty()) {
+            int d;
+            int u = Traits::pop(q, d);
+            if (d > dist[u]) continue; // stale entry
+
+            for (long long e = g.offsets[u]; e < g.offsets[u + 1]; e++) {
+                int v = g.to[e];
+                int new_dist = d + g.weight[e];
+
+                if (new_dist < dist[v]) {
+                    dist[v] = new_dist;
+                    Traits::push(q, new_dist, v);
+                }
+            }
+        }
+    }
+
+    return dist;
+}
+
+template <typename Queue, typename G>
+std::vector<int> dijkstra(const G &g, int source = 0) {
+    Queue q;
+    return dijkstra(g, q, source);
+}
+
+#endif
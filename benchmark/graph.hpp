@@ -0,0 +1,133 @@
+#ifndef GRAPH_HPP
+#define GRAPH_HPP
+
+#include <vector>
+#include <random>
+#include <memory>
+#include <utility>
+
+// Compressed Sparse Row graph: edges of u are [offsets[u], offsets[u + 1]) in to / weight.
+// to and weight are separate flat arrays, so the relaxation loop streams them linearly.
+// The arrays are read-only views; `backing` keeps them alive (owned vectors or an mmap'd file,
+// see graph_io.hpp), so a Graph is cheap to copy and move.
+struct Graph {
+    int V = 0;
+    long long E = 0;
+    const long long *offsets = nullptr; // size V + 1
+    const int *to = nullptr;            // size E
+    const int *weight = nullptr;        // size E
+
+    std::shared_ptr<const void> backing;
+
+    long long numEdges() const { return E; }
+};
+
+// owned CSR arrays, turned into a Graph by make_graph
+struct GraphArrays {
+    std::vector<long long> offsets;
+    std::vector<int> to;
+    std::vector<int> weight;
+};
+
+inline Graph make_graph(int V, GraphArrays &&arrays) {
+    auto owned = std::make_shared<GraphArrays>(std::move(arrays));
+
+    Graph g;
+    g.V = V;
+    g.E = owned->offsets.empty() ? 0 : owned->offsets.back();
+    g.offsets = owned->offsets.data();
+    g.to = owned->to.data();
+    g.weight = owned->weight.data();
+    g.backing = owned;
+    return g;
+}
+
+// uniform random directed graph, weights 1 ~ 100, no self-loop
+// every call starts a fresh generator from `seed`, so a (V, density, seed) triple is one fixed graph
+inline Graph generate_graph(int V, double density, unsigned seed = 42) {
+    GraphArrays a;
+
+    long long max_edges = (long long)(V) * (V - 1); // maximum number of the graph
+    long long target_edges = max_edges * (density / 100.0); // target_edges = max_edges * density
+
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<> dis_vertex(0, V - 1);
+    std::uniform_int_distribution<> dis_weight(1, 100); // 1 ~ 100
+
+    // pass 1: replay the random stream on a copy to count out-degrees
+    std::mt19937 counter = gen;
+    std::vector<long long> degree(V, 0);
+    for (long long i = 0; i < target_edges; ++i) {
+        int u = dis_vertex(counter);
+        int v = dis_vertex(counter);
+        if (u == v) {
+            // avoid self-loop
+            i--;
+            continue;
+        }
+        dis_weight(counter);
+        degree[u]++;
+    }
+
+    a.offsets.assign(V + 1, 0);
+    for (int u = 0; u < V; u++) a.offsets[u + 1] = a.offsets[u] + degree[u];
+
+    // pass 2: same stream on the real generator, scatter edges into place
+    a.to.resize(target_edges);
+    a.weight.resize(target_edges);
+    std::vector<long long> cursor(a.offsets.begin(), a.offsets.end() - 1);
+
+    for (long long i = 0; i < target_edges; ++i) {
+        int u = dis_vertex(gen);
+        int v = dis_vertex(gen);
+        if (u == v) {
+            i--;
+            continue;
+        }
+
+        long long e = cursor[u]++;
+        a.to[e] = v;
+        a.weight[e] = dis_weight(gen);
+    }
+
+    return make_graph(V, std::move(a));
+}
+
+// road-network-like graph: vertices on a ceil(sqrt(V)) wide grid, both directions of every
+// right / down neighbour edge, weights 1 ~ 100
+inline Graph generate_grid(int V, unsigned seed = 42) {
+    int cols = 1;
+    while ((long long)cols * cols < V) cols++;
+
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<> dis_weight(1, 100);
+
+    auto neighbours = [&](int u, int out[4]) {
+        int n = 0;
+        int r = u / cols, c = u % cols;
+        if (c > 0) out[n++] = u - 1;
+        if (c + 1 < cols && u + 1 < V) out[n++] = u + 1;
+        if (r > 0) out[n++] = u - cols;
+        if (u + cols < V) out[n++] = u + cols;
+        return n;
+    };
+
+    GraphArrays a;
+    a.offsets.assign(V + 1, 0);
+    int nb[4];
+    for (int u = 0; u < V; u++) a.offsets[u + 1] = a.offsets[u] + neighbours(u, nb);
+
+    a.to.resize(a.offsets[V]);
+    a.weight.resize(a.offsets[V]);
+    for (int u = 0; u < V; u++) {
+        int n = neighbours(u, nb);
+        for (int i = 0; i < n; i++) {
+            a.to[a.offsets[u] + i] = nb[i];
+            a.weight[a.offsets[u] + i] = dis_weight(gen);
+        }
+    }
+
+    return make_graph(V, std::move(a));
+}
+
+#endif
@@ -0,0 +1,256 @@
+#ifndef GRAPH_IO_HPP
+#define GRAPH_IO_HPP
+
+// Graph loading:
+//   load_dimacs  - 9th DIMACS challenge .gr text ("p sp n m" / "a u v w"), one streaming pass
+//   save_binary  - compact CSR image: GraphFileHeader + offsets + to + weight
+//   map_binary   - mmap that image and point the Graph straight at it (no parsing, no copy)
+//   load_graph   - .bin -> map_binary; .gr -> reuse / create "<path>.bin" cache next to it
+
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <memory>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/stat.h>
+#endif
+
+#include "graph.hpp"
+#include "mapped_file.hpp"
+
+struct GraphFileHeader {
+    char magic[8];       // "DSCSR\0\0\1"
+    std::int64_t V;
+    std::int64_t E;
+};
+
+static const char GRAPH_FILE_MAGIC[8] = {'D', 'S', 'C', 'S', 'R', 0, 0, 1};
+
+// DIMACS .gr -> CSR; vertex ids are 1-based in the file, 0-based in the Graph
+inline Graph load_dimacs(const std::string &path) {
+    std::unique_ptr<std::FILE, int(*)(std::FILE*)> f(std::fopen(path.c_str(), "rb"), &std::fclose);
+    if (!f) throw std::runtime_error("load_dimacs: cannot open " + path);
+
+    long long n = -1, m = -1, arcs = 0;
+    std::vector<int> src, dst, w;
+
+    // fixed-size read buffer, lines are parsed in place (a line may straddle two reads)
+    const std::size_t BUF_SIZE = 1 << 20;
+    std::vector<char> buf(BUF_SIZE + 1);
+    std::size_t len = 0;
+    bool eof = false;
+
+    auto parse_line = [&](const char *p, const char *end) {
+        auto next_int = [&](long long &out) {
+            while (p < end && (*p == ' ' || *p == '\t')) p++;
+            bool neg = (p < end && *p == '-');
+            if (neg) p++;
+            if (p >= end || *p < '0' || *p > '9') return false;
+            long long x = 0;
+            while (p < end && *p >= '0' && *p <= '9') x = x * 10 + (*p++ - '0');
+            out = neg ? -x : x;
+            return true;
+        };
+
+        if (p >= end) return;
+
+        if (*p == 'a') {
+            p++;
+            long long u, v, c;
+            if (n < 0 || !next_int(u) || !next_int(v) || !next_int(c) || u < 1 || u > n || v < 1 || v > n) {
+                throw std::runtime_error("load_dimacs: bad arc line in " + path);
+            }
+            // every shortest-path engine here assumes non-negative weights
+            if (c < 0 || c > 0x7fffffffLL) {
+                throw std::runtime_error("load_dimacs: arc weight out of range [0, INT_MAX] in " + path);
+            }
+            if (arcs == m) {
+                throw std::runtime_error("load_dimacs: more arc lines than m in " + path);
+            }
+            src.push_back((int)(u - 1));
+            dst.push_back((int)(v - 1));
+            w.push_back((int)c);
+            arcs++;
+        } else if (*p == 'p') {
+            p++;
+            while (p < end && (*p == ' ' || *p == '\t')) p++;
+            if (end - p < 2 || p[0] != 's' || p[1] != 'p') {
+                throw std::runtime_error("load_dimacs: expected 'p sp n m' in " + path);
+            }
+            p += 2;
+            if (!next_int(n) || !next_int(m) || n <= 0 || n > 0x7fffffffLL || m < 0) {
+                throw std::runtime_error("load_dimacs: bad problem line in " + path);
+            }
+            src.reserve(m);
+            dst.reserve(m);
+            w.reserve(m);
+        }
+        // 'c' comments and blank lines are skipped
+    };
+
+    while (!eof || len > 0) {
+        if (!eof) {
+            std::size_t got = std::fread(buf.data() + len, 1, BUF_SIZE - len, f.get());
+            if (got == 0) eof = true;
+            len += got;
+        }
+
+        char *begin = buf.data();
+        char *end = begin + len;
+        char *line = begin;
+
+        while (true) {
+            char *nl = static_cast<char*>(std::memchr(line, '\n', end - line));
+            if (!nl) break;
+            parse_line(line, nl);
+            line = nl + 1;
+        }
+
+        std::size_t rest = end - line;
+        if (eof) {
+            if (rest > 0) parse_line(line, end);
+            len = 0;
+        } else {
+            if (rest == BUF_SIZE) {
+                throw std::runtime_error("load_dimacs: line too long in " + path);
+            }
+            std::memmove(begin, line, rest);
+            len = rest;
+        }
+    }
+    f.reset();
+
+    if (n < 0) throw std::runtime_error("load_dimacs: missing problem line in " + path);
+    if (arcs != m) throw std::runtime_error("load_dimacs: fewer arc lines than m in " + path);
+
+    // counting sort by source (keeps file order inside each vertex)
+    GraphArrays a;
+    a.offsets.assign(n + 1, 0);
+    for (long long i = 0; i < arcs; i++) a.offsets[src[i] + 1]++;
+    for (long long u = 0; u < n; u++) a.offsets[u + 1] += a.offsets[u];
+
+    a.to.resize(arcs);
+    a.weight.resize(arcs);
+    std::vector<long long> cursor(a.offsets.begin(), a.offsets.end() - 1);
+    for (long long i = 0; i < arcs; i++) {
+        long long e = cursor[src[i]]++;
+        a.to[e] = dst[i];
+        a.weight[e] = w[i];
+    }
+
+    return make_graph((int)n, std::move(a));
+}
+
+inline void save_binary(const Graph &g, const std::string &path) {
+    std::FILE *f = std::fopen(path.c_str(), "wb");
+    if (!f) throw std::runtime_error("save_binary: cannot create " + path);
+
+    GraphFileHeader h;
+    std::memcpy(h.magic, GRAPH_FILE_MAGIC, sizeof(h.magic));
+    h.V = g.V;
+    h.E = g.E;
+
+    bool ok = std::fwrite(&h, sizeof(h), 1, f) == 1
+        && std::fwrite(g.offsets, sizeof(long long), g.V + 1, f) == (std::size_t)(g.V + 1)
+        && std::fwrite(g.to, sizeof(int), g.E, f) == (std::size_t)g.E
+        && std::fwrite(g.weight, sizeof(int), g.E, f) == (std::size_t)g.E;
+
+    if (std::fclose(f) != 0 || !ok) {
+        std::remove(path.c_str());
+        throw std::runtime_error("save_binary: write failed for " + path);
+    }
+}
+
+// check header, size and CSR structure (offsets from 0 to E, non-decreasing, every target
+// in [0, V), weights non-negative), return a Graph pointing into [base, base + size)
+inline Graph graph_from_image(const char *base, std::size_t size, const std::string &path) {
+    GraphFileHeader h;
+    if (size < sizeof(h)) throw std::runtime_error("map_binary: truncated file " + path);
+    std::memcpy(&h, base, sizeof(h));
+
+    if (std::memcmp(h.magic, GRAPH_FILE_MAGIC, sizeof(h.magic)) != 0 || h.V <= 0 || h.E < 0
+        || h.V > 0x7fffffffLL) {
+        throw std::runtime_error("map_binary: not a graph image " + path);
+    }
+
+    // E bounded by the file size first, so the expected size below cannot overflow
+    if ((std::uint64_t)h.E > size / (2 * sizeof(int))) {
+        throw std::runtime_error("map_binary: size mismatch in " + path);
+    }
+    std::size_t expected = sizeof(h) + sizeof(long long) * (h.V + 1) + 2 * sizeof(int) * h.E;
+    if (size != expected) throw std::runtime_error("map_binary: size mismatch in " + path);
+
+    Graph g;
+    g.V = (int)h.V;
+    g.E = h.E;
+    g.offsets = reinterpret_cast<const long long*>(base + sizeof(h));
+    g.to = reinterpret_cast<const int*>(g.offsets + g.V + 1);
+    g.weight = g.to + g.E;
+
+    if (g.offsets[0] != 0 || g.offsets[g.V] != g.E) {
+        throw std::runtime_error("map_binary: corrupt offsets in " + path);
+    }
+    for (int u = 0; u < g.V; u++) {
+        if (g.offsets[u + 1] < g.offsets[u]) {
+            throw std::runtime_error("map_binary: corrupt offsets in " + path);
+        }
+    }
+    for (long long e = 0; e < g.E; e++) {
+        if (g.to[e] < 0 || g.to[e] >= g.V || g.weight[e] < 0) {
+            throw std::runtime_error("map_binary: corrupt arc in " + path);
+        }
+    }
+    return g;
+}
+
+inline Graph map_binary(const std::string &path) {
+    MappedFile file = map_file(path, "map_binary");
+    Graph g = graph_from_image(file.data, file.size, path);
+    g.backing = file.backing;
+    return g;
+}
+
+inline bool ends_with(const std::string &s, const std::string &suffix) {
+    return s.size() >= suffix.size() && s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+// cache exists and is not older than the text file
+inline bool cache_is_fresh(const std::string &path, const std::string &cache) {
+#ifdef MAPPED_FILE_MMAP
+    struct stat src, bin;
+    if (::stat(cache.c_str(), &bin) != 0) return false;
+    return ::stat(path.c_str(), &src) != 0 || bin.st_mtime >= src.st_mtime;
+#else
+    std::FILE *f = std::fopen(cache.c_str(), "rb");
+    if (f) std::fclose(f);
+    return f != nullptr;
+#endif
+}
+
+// .bin: mmap it; anything else: DIMACS text, cached as "<path>.bin" for later runs
+inline Graph load_graph(const std::string &path) {
+    if (ends_with(path, ".bin")) return map_binary(path);
+
+    std::string cache = path + ".bin";
+    if (cache_is_fresh(path, cache)) {
+        try {
+            return map_binary(cache);
+        } catch (const std::exception&) {
+            // stale / broken cache: rebuild below
+        }
+    }
+
+    Graph g = load_dimacs(path);
+    try {
+        save_binary(g, cache);
+    } catch (const std::exception&) {
+        // read-only directory: keep the parsed graph, just no cache
+    }
+    return g;
+}
+
+#endif
@@ -0,0 +1,308 @@
+#ifndef HARNESS_HPP
+#define HARNESS_HPP
+
+// Benchmark harness support for the density sweep:
+//   BenchOptions / parse_options - command line (V, densities, seeds, graph family, reps, ...)
+//   summarize                    - min / median / mean / p90 / p99 / stddev of repeated samples
+//   pin_to_cpu                   - sched_setaffinity on Linux, no-op elsewhere
+//   collect_host_info            - compiler, flags, host, CPU model, last-level cache, kernel, timestamp
+//   json_escape                  - for the hand-written JSON report
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/utsname.h>
+#include <unistd.h>
+#endif
+
+// set by the Makefile (-DBENCH_CXXFLAGS='"..."')
+#ifndef BENCH_CXXFLAGS
+#define BENCH_CXXFLAGS "unknown"
+#endif
+
+struct BenchOptions {
+    int V = 4000;
+    std::vector<double> densities = {0.1, 0.5, 1.0, 2.5, 5.0, 10.0, 20.0, 30.0, 40.0, 50.0,
+                                     60.0, 70.0, 80.0, 90.0, 100.0};
+    std::vector<unsigned> seeds = {42};
+    std::string family = "uniform";    // uniform | grid | file
+    std::string graphPath;             // family == file
+    int reps = 5;                      // timed runs per (graph, variant)
+    int warmup = 1;                    // untimed runs per (graph, variant)
+    int pinCpu = -1;                   // -1 = no pinning
+    unsigned orderSeed = 1;            // shuffles the run order
+    std::vector<std::string> variants; // empty = all
+    bool counters = true;              // hardware counters (perf_counters.hpp) when available
+    std::string out = "benchmark_result"; // <out>.csv, <out>_stats.csv, <out>.json
+};
+
+inline void print_usage(const char *prog) {
+    std::printf(
+        "Usage: %s [options]\n"
+        "  --V <n>              vertices for generated graphs (default 4000)\n"
+        "  --densities <list>   comma separated edge densities in %% (uniform family)\n"
+        "  --seeds <list>       comma separated graph seeds (default 42)\n"
+        "  --family <name>      uniform | grid | file (default uniform)\n"
+        "  --graph <path>       .gr / .bin file for --family file\n"
+        "  --reps <n>           timed runs per variant and graph (default 5)\n"
+        "  --warmup <n>         untimed runs per variant and graph (default 1)\n"
+        "  --pin <cpu>          pin the process to one CPU\n"
+        "  --order-seed <n>     seed of the randomized run order (default 1)\n"
+        "  --variants <list>    comma separated subset, e.g. Binary,Pairing_OPT\n"
+        "  --counters <0|1>     read hardware counters around every timed run (default 1)\n"
+        "  --out <prefix>       output prefix (default benchmark_result)\n",
+        prog);
+}
+
+inline std::vector<std::string> split_list(const std::string &s) {
+    std::vector<std::string> items;
+    std::stringstream ss(s);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) items.push_back(item);
+    }
+    return items;
+}
+
+// argv[start..]: "--key value" pairs; false + error message on bad input
+inline bool parse_options(int argc, char *argv[], int start, BenchOptions &opt, std::string &error) {
+    auto to_long = [&](const std::string &key, const std::string &s, long lo, long &out) {
+        char *end = nullptr;
+        out = std::strtol(s.c_str(), &end, 10);
+        if (s.empty() || *end != '\0' || out < lo) {
+            error = "bad value for " + key + ": " + s;
+            return false;
+        }
+        return true;
+    };
+
+    for (int i = start; i < argc; i++) {
+        std::string key = argv[i];
+        if (key == "--help" || key == "-h") {
+            error = "";
+            return false;
+        }
+        if (i + 1 >= argc) {
+            error = "missing value for " + key;
+            return false;
+        }
+        std::string value = argv[++i];
+        long n;
+
+        if (key == "--V") {
+            if (!to_long(key, value, 2, n)) return false;
+            opt.V = (int)n;
+        } else if (key == "--densities") {
+            opt.densities.clear();
+            for (const std::string &d : split_list(value)) {
+                char *end = nullptr;
+                double x = std::strtod(d.c_str(), &end);
+                if (*end != '\0' || x <= 0 || x > 100) {
+                    error = "bad density: " + d;
+                    return false;
+                }
+                opt.densities.push_back(x);
+            }
+        } else if (key == "--seeds") {
+            opt.seeds.clear();
+            for (const std::string &s : split_list(value)) {
+                if (!to_long(key, s, 0, n)) return false;
+                opt.seeds.push_back((unsigned)n);
+            }
+        } else if (key == "--family") {
+            if (value != "uniform" && value != "grid" && value != "file") {
+                error = "unknown graph family: " + value;
+                return false;
+            }
+            opt.family = value;
+        } else if (key == "--graph") {
+            opt.graphPath = value;
+        } else if (key == "--reps") {
+            if (!to_long(key, value, 1, n)) return false;
+            opt.reps = (int)n;
+        } else if (key == "--warmup") {
+            if (!to_long(key, value, 0, n)) return false;
+            opt.warmup = (int)n;
+        } else if (key == "--pin") {
+            if (!to_long(key, value, 0, n)) return false;
+            opt.pinCpu = (int)n;
+        } else if (key == "--order-seed") {
+            if (!to_long(key, value, 0, n)) return false;
+            opt.orderSeed = (unsigned)n;
+        } else if (key == "--variants") {
+            opt.variants = split_list(value);
+        } else if (key == "--counters") {
+            if (!to_long(key, value, 0, n) || n > 1) {
+                error = "bad value for --counters: " + value;
+                return false;
+            }
+            opt.counters = n == 1;
+        } else if (key == "--out") {
+            opt.out = value;
+        } else {
+            error = "unknown option: " + key;
+            return false;
+        }
+    }
+
+    if (opt.densities.empty() || opt.seeds.empty()) {
+        error = "empty density / seed list";
+        return false;
+    }
+    if (opt.family == "file" && opt.graphPath.empty()) {
+        error = "--family file needs --graph <path>";
+        return false;
+    }
+    if (!opt.graphPath.empty()) opt.family = "file";
+    return true;
+}
+
+struct SampleStats {
+    int n = 0;
+    double min = 0, median = 0, mean = 0, p90 = 0, p99 = 0, max = 0, stddev = 0;
+};
+
+// nearest-rank percentiles; stddev is the sample (n - 1) standard deviation
+inline SampleStats summarize(std::vector<double> samples) {
+    SampleStats s;
+    s.n = (int)samples.size();
+    if (samples.empty()) return s;
+
+    std::sort(samples.begin(), samples.end());
+    auto rank = [&](double p) {
+        std::size_t k = (std::size_t)std::ceil(p * samples.size());
+        return samples[k == 0 ? 0 : k - 1];
+    };
+
+    s.min = samples.front();
+    s.max = samples.back();
+    std::size_t mid = samples.size() / 2;
+    s.median = samples.size() % 2 ? samples[mid] : (samples[mid - 1] + samples[mid]) / 2;
+    s.p90 = rank(0.90);
+    s.p99 = rank(0.99);
+
+    double sum = 0;
+    for (double x : samples) sum += x;
+    s.mean = sum / samples.size();
+
+    double sq = 0;
+    for (double x : samples) sq += (x - s.mean) * (x - s.mean);
+    s.stddev = samples.size() > 1 ? std::sqrt(sq / (samples.size() - 1)) : 0.0;
+    return s;
+}
+
+// true when the calling process now only runs on `cpu`
+inline bool pin_to_cpu(int cpu) {
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+struct HostInfo {
+    std::string compiler;
+    std::string flags;
+    std::string hostname;
+    std::string os;
+    std::string cpu;
+    unsigned hardwareThreads = 0;
+    long long llcBytes = -1; // last-level cache size, -1 if unknown
+    std::string timestamp; // UTC, ISO 8601
+};
+
+inline HostInfo collect_host_info() {
+    HostInfo h;
+
+#if defined(__clang__)
+    h.compiler = std::string("clang ") + __clang_version__;
+#elif defined(__GNUC__)
+    h.compiler = std::string("g++ ") + __VERSION__;
+#else
+    h.compiler = "unknown";
+#endif
+    h.flags = BENCH_CXXFLAGS;
+#ifdef NDEBUG
+    h.flags += " -DNDEBUG";
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+    char name[256] = {0};
+    if (gethostname(name, sizeof(name) - 1) == 0) h.hostname = name;
+    struct utsname u;
+    if (uname(&u) == 0) h.os = std::string(u.sysname) + " " + u.release + " " + u.machine;
+#endif
+
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+        if (line.compare(0, 10, "model name") == 0) {
+            std::size_t colon = line.find(':');
+            if (colon != std::string::npos) h.cpu = line.substr(colon + 2);
+            break;
+        }
+    }
+    if (h.cpu.empty()) h.cpu = "unknown";
+
+    h.hardwareThreads = std::thread::hardware_concurrency();
+
+#if defined(_SC_LEVEL3_CACHE_SIZE)
+    long l3 = sysconf(_SC_LEVEL3_CACHE_SIZE);
+    if (l3 > 0) h.llcBytes = l3;
+#endif
+    if (h.llcBytes < 0) {
+        // sysfs: "105M", "32768K", ... (index3 = L3 on x86 and most arm64 parts)
+        std::ifstream size("/sys/devices/system/cpu/cpu0/cache/index3/size");
+        long long n = 0;
+        char unit = 0;
+        if (size >> n) {
+            size >> unit;
+            h.llcBytes = unit == 'M' ? n << 20 : unit == 'K' ? n << 10 : n;
+        }
+    }
+
+    char buf[32];
+    std::time_t now = std::time(nullptr);
+    std::strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+    h.timestamp = buf;
+    return h;
+}
+
+inline std::string json_escape(const std::string &s) {
+    std::string out;
+    for (char c : s) {
+        switch (c) {
+        case '"':  out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\n': out += "\\n"; break;
+        case '\t': out += "\\t"; break;
+        default:
+            if ((unsigned char)c < 0x20) {
+                char esc[8];
+                std::snprintf(esc, sizeof(esc), "\\u%04x", c);
+                out += esc;
+            } else {
+                out += c;
+            }
+        }
+    }
+    return out;
+}
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+// Read-only view of a whole file: mmap where available, otherwise read into memory.
+// `backing` owns the mapping / buffer, so views into [data, data + size) stay valid as long as
+// a copy of it is alive.
+
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define MAPPED_FILE_MMAP 1
+#endif
+
+struct MappedFile {
+    const char *data = nullptr;
+    std::size_t size = 0;
+    std::shared_ptr<const void> backing;
+};
+
+// `who` prefixes the error messages ("map_binary", "map_trace", ...)
+inline MappedFile map_file(const std::string &path, const std::string &who) {
+    MappedFile m;
+#ifdef MAPPED_FILE_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error(who + ": cannot open " + path);
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || st.st_size <= 0) {
+        ::close(fd);
+        throw std::runtime_error(who + ": cannot stat " + path);
+    }
+
+    std::size_t size = (std::size_t)st.st_size;
+    void *base = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (base == MAP_FAILED) throw std::runtime_error(who + ": mmap failed for " + path);
+
+    m.data = static_cast<const char*>(base);
+    m.size = size;
+    m.backing = std::shared_ptr<const void>(base, [size](const void *p) { ::munmap(const_cast<void*>(p), size); });
+#else
+    // no mmap: read the whole file into memory
+    std::FILE *f = std::fopen(path.c_str(), "rb");
+    if (!f) throw std::runtime_error(who + ": cannot open " + path);
+    auto image = std::make_shared<std::vector<char>>();
+    char chunk[1 << 16];
+    std::size_t got;
+    while ((got = std::fread(chunk, 1, sizeof(chunk), f)) > 0) image->insert(image->end(), chunk, chunk + got);
+    std::fclose(f);
+
+    m.data = image->data();
+    m.size = image->size();
+    m.backing = image;
+#endif
+    return m;
+}
+
+#endif
@@ -0,0 +1,477 @@
+// Per-operation microbenchmark: every heap primitive timed in isolation (no graph traversal).
+//   insert      - n inserts into an empty heap
+//   decreaseKey - every handle once, random order (addressable heaps only)
+//   deleteMin   - drain the n-element heap
+//   meld        - fold n / 64 heaps of 64 keys into one (meldable heaps only)
+// Key distributions: sorted, reverse, random, adversarial (see make_keys).
+// Key types: int, string (36 chars, past the small-string buffer), big (128-byte struct); keys
+// are built before the timed loops and moved into the heaps, so a heap that copies shows up in
+// the allocation column.
+// Reports median ns/op over the repetitions and heap allocations per op (global operator new
+// is replaced below). Output: console + microbench_result.csv.
+//
+// usage: ./microbench [--sizes 1000,10000,...] [--heaps Opt_Pairing,...] [--dists sorted,...]
+//                     [--keys int,string,big] [--seed n]
+// array layouts at large n (textbook vs blocked vs std):
+//   ./microbench --heaps BinaryHeap,BHeap_Line,BHeap_Page,Std_PQ --dists random
+//                --sizes 100000,1000000,10000000,100000000
+
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include <queue>
+#include <random>
+#include <chrono>
+#include <string>
+#include <functional>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include <pthread.h>
+
+#include "../baseline/binary_heap.hpp" // min-binary-heap
+#include "../baseline/b_heap.hpp" // min-heap, blocked (B-heap) layout
+#include "../datastructure/origin/pairing_heap_no.hpp" // min-pairing-heap (no memory pool)
+#include "../datastructure/optimize/pairing_heap.hpp" // min-pairing-heap
+#include "harness.hpp" // split_list, summarize
+
+using namespace std;
+
+// ==========================================
+// 記憶體配置計數 (取代全域 operator new / delete)
+// ==========================================
+static size_t g_allocs = 0;
+static size_t g_alloc_bytes = 0;
+
+void *operator new(size_t size) {
+    g_allocs++;
+    g_alloc_bytes += size;
+    if (void *p = malloc(size ? size : 1)) return p;
+    throw bad_alloc();
+}
+void *operator new[](size_t size) { return ::operator new(size); }
+void operator delete(void *p) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete[](void *p, size_t) noexcept { free(p); }
+// over-aligned (BHeap blocks)
+void *operator new(size_t size, align_val_t align) {
+    g_allocs++;
+    g_alloc_bytes += size;
+    size_t a = (size_t)align;
+    if (void *p = aligned_alloc(a, (size + a - 1) / a * a)) return p;
+    throw bad_alloc();
+}
+void operator delete(void *p, align_val_t) noexcept { free(p); }
+void operator delete(void *p, size_t, align_val_t) noexcept { free(p); }
+
+// ==========================================
+// Key types
+// ==========================================
+// fixed-width decimal, so string order = numeric order (offset keeps decreaseKey targets >= 0)
+struct StringKey {
+    static const char *name() { return "string"; }
+    static string make(int v) {
+        char buf[40];
+        snprintf(buf, sizeof(buf), "key-%032lld", (long long)v + (1LL << 40));
+        return buf;
+    }
+    static long long sink(const string &k) { return (long long)k.size(); }
+};
+
+// 128-byte record compared by its int key
+struct BigKey {
+    int key;
+    char pad[124];
+
+    bool operator>(const BigKey &other) const { return key > other.key; }
+    bool operator<(const BigKey &other) const { return key < other.key; }
+};
+
+template <typename K>
+struct KeyOf {
+    static const char *name() { return "int"; }
+    static K make(int v) { return v; }
+    static long long sink(const K &k) { return k; }
+};
+
+template <>
+struct KeyOf<string> : StringKey {};
+
+template <>
+struct KeyOf<BigKey> {
+    static const char *name() { return "big"; }
+    static BigKey make(int v) {
+        BigKey k;
+        k.key = v;
+        fill(begin(k.pad), end(k.pad), (char)v);
+        return k;
+    }
+    static long long sink(const BigKey &k) { return k.key; }
+};
+
+// ==========================================
+// Heap adapters: one interface for every heap
+// (MeldHeap: type of the n / 64 small heaps of the meld case)
+// ==========================================
+template <typename K>
+struct OptPairing {
+    using Heap = Opt::PairingHeap<K>;
+    // 64-node pool blocks: a default 4096-node block per 64-key heap would cost ~2 KiB per key
+    using MeldHeap = Opt::PairingHeap<K, Opt::TwoPass, Opt::NoStats, Opt::Locality<false, ReuseFirst, NewBackend, 64>>;
+    using Handle = Opt::Node<K>*;
+    static constexpr bool addressable = true;
+    static constexpr bool meldable = true;
+    static constexpr bool recursive = false;
+    static const char *name() { return "Opt_Pairing"; }
+
+    static Handle push(Heap &h, K &&k) { return h.insert(std::move(k)); }
+    static K pop(Heap &h) { return h.deleteMin(); }
+    static void decrease(Heap &h, Handle x, K &&k) { h.decreaseKey(x, std::move(k)); }
+    static void meldPush(MeldHeap &h, K &&k) { h.insert(std::move(k)); }
+    static void meld(MeldHeap &a, MeldHeap &b) { a.meld(b); }
+};
+
+template <typename K>
+struct OriginPairing {
+    using Heap = Origin::PairingHeap_NO<K>;
+    using MeldHeap = Heap;
+    using Handle = Origin::Node<K>*;
+    static constexpr bool addressable = true;
+    static constexpr bool meldable = true;
+    static constexpr bool recursive = true; // recursive twoPassMerge / clear: needs a deep stack
+    static const char *name() { return "Origin_Pairing_NO"; }
+
+    static Handle push(Heap &h, K &&k) { return h.insert(std::move(k)); }
+    static K pop(Heap &h) { return h.deleteMin(); }
+    static void decrease(Heap &h, Handle x, K &&k) { h.decreaseKey(x, std::move(k)); }
+    static void meldPush(MeldHeap &h, K &&k) { h.insert(std::move(k)); }
+    static void meld(MeldHeap &a, MeldHeap &b) { a.meld(b); }
+};
+
+template <typename K>
+struct Binary {
+    using Heap = BinaryHeap<K>;
+    using Handle = int;
+    static constexpr bool addressable = false;
+    static constexpr bool meldable = false;
+    static constexpr bool recursive = false;
+    static const char *name() { return "BinaryHeap"; }
+
+    static Handle push(Heap &h, K &&k) { h.push(std::move(k)); return 0; }
+    static K pop(Heap &h) { return h.deleteMin(); }
+    static void decrease(Heap&, Handle, K&&) {}
+    static void meld(Heap&, Heap&) {}
+};
+
+// BlockBytes = 64: cache-line blocks, 4096: page blocks
+template <typename K, size_t BlockBytes>
+struct Blocked {
+    using Heap = BHeap<K, BlockBytes>;
+    using Handle = int;
+    static constexpr bool addressable = false;
+    static constexpr bool meldable = false;
+    static constexpr bool recursive = false;
+    static const char *name() { return BlockBytes == 64 ? "BHeap_Line" : "BHeap_Page"; }
+
+    static Handle push(Heap &h, K &&k) { h.push(std::move(k)); return 0; }
+    static K pop(Heap &h) { return h.deleteMin(); }
+    static void decrease(Heap&, Handle, K&&) {}
+    static void meld(Heap&, Heap&) {}
+};
+
+template <typename K>
+struct StdPQ {
+    using Heap = priority_queue<K, vector<K>, greater<K>>;
+    using Handle = int;
+    static constexpr bool addressable = false;
+    static constexpr bool meldable = false;
+    static constexpr bool recursive = false;
+    static const char *name() { return "Std_PQ"; }
+
+    static Handle push(Heap &h, K &&k) { h.push(std::move(k)); return 0; }
+    static K pop(Heap &h) { K k = h.top(); h.pop(); return k; } // top() is const: copy
+    static void decrease(Heap&, Handle, K&&) {}
+    static void meld(Heap&, Heap&) {}
+};
+
+// ==========================================
+// Workloads
+// ==========================================
+const char *const DISTS[] = {"sorted", "reverse", "random", "adversarial"};
+const char *const KEYS[] = {"int", "string", "big"};
+
+// sorted / reverse / random: keys 0..n-1 in that order
+// adversarial: small keys ascending interleaved with large keys descending (0, n-1, 1, n-2, ...):
+//   every small key sifts up through the large ones in an array heap, and a pairing heap root
+//   collects all n nodes as direct children (worst first deleteMin); decreaseKey then makes every
+//   touched node the new minimum, so each one relinks the root
+vector<int> make_keys(const string &dist, int n, unsigned seed) {
+    vector<int> keys(n);
+    if (dist == "adversarial") {
+        for (int i = 0; i < n; i++) keys[i] = (i % 2 == 0) ? i / 2 : n - 1 - i / 2;
+        return keys;
+    }
+    for (int i = 0; i < n; i++) keys[i] = i;
+    if (dist == "reverse") reverse(keys.begin(), keys.end());
+    else if (dist == "random") shuffle(keys.begin(), keys.end(), mt19937(seed));
+    return keys;
+}
+
+struct OpResult {
+    string op;
+    long long ops = 0;       // per repetition
+    vector<double> nsPerOp;  // one sample per repetition
+    size_t allocs = 0;       // summed over repetitions
+    size_t bytes = 0;
+    int reps = 0;
+};
+
+// time fn() once, return elapsed ns; allocation counters are added to r
+template <typename Func>
+double timed(OpResult &r, Func fn) {
+    size_t a0 = g_allocs, b0 = g_alloc_bytes;
+    auto start = chrono::steady_clock::now();
+    fn();
+    auto end = chrono::steady_clock::now();
+    r.allocs += g_allocs - a0;
+    r.bytes += g_alloc_bytes - b0;
+    return chrono::duration<double, nano>(end - start).count();
+}
+
+template <typename A, typename K>
+vector<OpResult> run_case(const vector<int> &keys, bool adversarial, unsigned seed, int reps) {
+    const int n = (int)keys.size();
+    OpResult ins, dec, del, mel;
+    ins.op = "insert"; dec.op = "decreaseKey"; del.op = "deleteMin"; mel.op = "meld";
+
+    // decreaseKey visits handles in one fixed random order
+    vector<int> order(n);
+    for (int i = 0; i < n; i++) order[i] = i;
+    shuffle(order.begin(), order.end(), mt19937(seed + 1));
+
+    vector<typename A::Handle> handles(n);
+    volatile long long sink = 0;
+
+    // keys of this repetition, built outside the timed loops and moved in
+    vector<K> pushed(n), lowered(n);
+
+    for (int rep = 0; rep < reps; rep++) {
+        for (int i = 0; i < n; i++) pushed[i] = KeyOf<K>::make(keys[i]);
+        if constexpr (A::addressable) {
+            for (int j = 0; j < n; j++) {
+                // adversarial: every decrease becomes the new global minimum
+                lowered[j] = KeyOf<K>::make(adversarial ? -1 - j : keys[order[j]] - n);
+            }
+        }
+
+        {
+            typename A::Heap heap;
+
+            double t = timed(ins, [&]() {
+                for (int i = 0; i < n; i++) handles[i] = A::push(heap, std::move(pushed[i]));
+            });
+            ins.nsPerOp.push_back(t / n);
+            ins.ops = n;
+
+            if constexpr (A::addressable) {
+                t = timed(dec, [&]() {
+                    for (int j = 0; j < n; j++) A::decrease(heap, handles[order[j]], std::move(lowered[j]));
+                });
+                dec.nsPerOp.push_back(t / n);
+                dec.ops = n;
+            }
+
+            t = timed(del, [&]() {
+                long long s = 0;
+                for (int i = 0; i < n; i++) s += KeyOf<K>::sink(A::pop(heap));
+                sink = sink + s;
+            });
+            del.nsPerOp.push_back(t / n);
+            del.ops = n;
+        }
+
+        if constexpr (A::meldable) {
+            // last repetition: the other cases' buffers are done, free them before n more
+            // nodes are built (keeps the meld peak below the insert peak at large n)
+            if (rep == reps - 1) {
+                vector<typename A::Handle>().swap(handles);
+                vector<K>().swap(pushed);
+                vector<K>().swap(lowered);
+                vector<int>().swap(order);
+            }
+
+            const int CHUNK = 64;
+            int parts = max(1, n / CHUNK);
+            vector<typename A::MeldHeap> heaps(parts);
+            for (int i = 0; i < n; i++) A::meldPush(heaps[min(parts - 1, i / CHUNK)], KeyOf<K>::make(keys[i]));
+
+            double t = timed(mel, [&]() {
+                for (int p = 1; p < parts; p++) A::meld(heaps[0], heaps[p]);
+            });
+            if (parts > 1) {
+                mel.nsPerOp.push_back(t / (parts - 1));
+                mel.ops = parts - 1;
+            }
+        }
+    }
+
+    vector<OpResult> out;
+    for (OpResult *r : {&ins, &dec, &del, &mel}) {
+        if (r->nsPerOp.empty()) continue;
+        r->reps = (int)r->nsPerOp.size();
+        out.push_back(*r);
+    }
+    return out;
+}
+
+// run fn on a thread with at least `bytes` of stack; false if that thread cannot be created
+bool run_with_stack(size_t bytes, const function<void()> &fn) {
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    if (pthread_attr_setstacksize(&attr, bytes) != 0) {
+        pthread_attr_destroy(&attr);
+        return false;
+    }
+
+    pthread_t th;
+    auto entry = [](void *arg) -> void* {
+        (*static_cast<const function<void()>*>(arg))();
+        return nullptr;
+    };
+    int rc = pthread_create(&th, &attr, entry, const_cast<function<void()>*>(&fn));
+    pthread_attr_destroy(&attr);
+    if (rc != 0) return false;
+
+    pthread_join(th, nullptr);
+    return true;
+}
+
+template <typename A, typename K>
+bool bench_heap(int n, const string &dist, unsigned seed, ofstream &csv) {
+    vector<int> keys = make_keys(dist, n, seed);
+    // small heaps are repeated so every sample covers >= ~1e6 operations
+    int reps = n >= 10000000 ? 1 : max(3, 1000000 / n);
+
+    vector<OpResult> results;
+    auto job = [&]() { results = run_case<A, K>(keys, dist == "adversarial", seed, reps); };
+
+    if (A::recursive) {
+        // recursion depth can reach n (chains / long child lists)
+        if (!run_with_stack((size_t)64 * 1024 * 1024 + (size_t)n * 256, job)) {
+            cout << "   " << left << setw(18) << A::name() << right << " skipped (no stack for n = " << n << ")" << endl;
+            return false;
+        }
+    } else {
+        job();
+    }
+
+    for (const OpResult &r : results) {
+        SampleStats st = summarize(r.nsPerOp);
+        double total_ops = (double)r.ops * r.reps;
+
+        cout << "   " << left << setw(18) << A::name() << setw(12) << r.op << right
+             << setw(10) << st.median << " ns/op   min " << setw(9) << st.min
+             << "   allocs/op " << setw(6) << r.allocs / total_ops
+             << "   B/op " << setw(7) << r.bytes / total_ops << endl;
+
+        csv << A::name() << "," << KeyOf<K>::name() << "," << dist << "," << n << "," << r.op << "," << r.ops << "," << r.reps << ","
+            << st.median << "," << st.min << "," << st.p90 << ","
+            << r.allocs / total_ops << "," << r.bytes / total_ops << "\n";
+    }
+    return true;
+}
+
+// one key type: every requested heap on (n, dist); false on an unknown heap name
+template <typename K>
+bool bench_keys(const vector<string> &heaps, int n, const string &dist, unsigned seed, ofstream &csv) {
+    for (const string &h : heaps) {
+        if (h == OptPairing<K>::name()) bench_heap<OptPairing<K>, K>(n, dist, seed, csv);
+        else if (h == OriginPairing<K>::name()) bench_heap<OriginPairing<K>, K>(n, dist, seed, csv);
+        else if (h == Binary<K>::name()) bench_heap<Binary<K>, K>(n, dist, seed, csv);
+        else if (h == Blocked<K, 64>::name()) bench_heap<Blocked<K, 64>, K>(n, dist, seed, csv);
+        else if (h == Blocked<K, 4096>::name()) bench_heap<Blocked<K, 4096>, K>(n, dist, seed, csv);
+        else if (h == StdPQ<K>::name()) bench_heap<StdPQ<K>, K>(n, dist, seed, csv);
+        else {
+            cerr << "Error: unknown heap " << h << endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    vector<int> sizes = {1000, 10000, 100000, 1000000};
+    vector<string> heaps = {"Opt_Pairing", "Origin_Pairing_NO", "BinaryHeap", "Std_PQ"};
+    vector<string> dists(begin(DISTS), end(DISTS));
+    vector<string> keyTypes = {"int"};
+    unsigned seed = 42;
+
+    for (int i = 1; i < argc; i++) {
+        string key = argv[i];
+        if (i + 1 >= argc) {
+            cout << "Usage: " << argv[0]
+                 << " [--sizes 1000,...,100000000] [--heaps Opt_Pairing,Origin_Pairing_NO,BinaryHeap,BHeap_Line,BHeap_Page,Std_PQ]"
+                 << " [--dists sorted,reverse,random,adversarial] [--keys int,string,big] [--seed n]" << endl;
+            return key == "--help" || key == "-h" ? 0 : 1;
+        }
+        string value = argv[++i];
+        if (key == "--sizes") {
+            sizes.clear();
+            for (const string &s : split_list(value)) {
+                long long n = atoll(s.c_str());
+                if (n < 1 || n > 1000000000LL) {
+                    cerr << "Error: bad size " << s << endl;
+                    return 1;
+                }
+                sizes.push_back((int)n);
+            }
+        } else if (key == "--heaps") {
+            heaps = split_list(value);
+        } else if (key == "--dists") {
+            dists = split_list(value);
+        } else if (key == "--keys") {
+            keyTypes = split_list(value);
+        } else if (key == "--seed") {
+            seed = (unsigned)atol(value.c_str());
+        } else {
+            cerr << "Error: unknown option " << key << endl;
+            return 1;
+        }
+    }
+
+    for (const string &d : dists) {
+        if (find(begin(DISTS), end(DISTS), d) == end(DISTS)) {
+            cerr << "Error: unknown distribution " << d << endl;
+            return 1;
+        }
+    }
+    for (const string &k : keyTypes) {
+        if (find(begin(KEYS), end(KEYS), k) == end(KEYS)) {
+            cerr << "Error: unknown key type " << k << endl;
+            return 1;
+        }
+    }
+
+    ofstream csv("microbench_result.csv");
+    csv << "Heap,Key,Distribution,N,Op,OpsPerRep,Reps,Median(ns/op),Min(ns/op),P90(ns/op),AllocsPerOp,BytesPerOp\n";
+
+    cout << fixed << setprecision(2);
+    for (const string &k : keyTypes) {
+        for (int n : sizes) {
+            for (const string &dist : dists) {
+                cout << "n = " << n << ", keys = " << dist << " (" << k << ")" << endl;
+                bool ok = k == "int"    ? bench_keys<int>(heaps, n, dist, seed, csv)
+                        : k == "string" ? bench_keys<string>(heaps, n, dist, seed, csv)
+                        :                 bench_keys<BigKey>(heaps, n, dist, seed, csv);
+                if (!ok) return 1;
+            }
+        }
+    }
+
+    cout << "Data saved to 'microbench_result.csv'" << endl;
+    return 0;
+}
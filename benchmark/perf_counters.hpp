@@ -0,0 +1,128 @@
+#ifndef PERF_COUNTERS_HPP
+#define PERF_COUNTERS_HPP
+
+// Hardware counters around a timed region via perf_event_open (Linux, user space only).
+//   PerfCounters pc;            // opens whatever the kernel / PMU allows
+//   pc.start(); work(); auto v = pc.stop();
+// Every event is its own counter; values are scaled by time_enabled / time_running when the
+// kernel multiplexes them. An event that cannot be opened (no PMU in a VM, perf_event_paranoid,
+// non-Linux build) reads as -1, so callers only have to skip negative values.
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define PERF_COUNTERS_LINUX 1
+#endif
+
+class PerfCounters {
+public:
+    enum Event { CYCLES, INSTRUCTIONS, L1D_MISSES, LLC_MISSES, BRANCH_MISSES, DTLB_MISSES, COUNT };
+    using Values = std::array<double, COUNT>;
+
+    // CSV column / JSON key names, in Event order
+    static const char *name(int e) {
+        static const char *const names[COUNT] = {
+            "Cycles", "Instructions", "L1dMisses", "LLCMisses", "BranchMisses", "dTLBMisses"};
+        return names[e];
+    }
+
+    PerfCounters() {
+        fds.fill(-1);
+#ifdef PERF_COUNTERS_LINUX
+        auto cache = [](std::uint64_t id) {
+            return id | ((std::uint64_t)PERF_COUNT_HW_CACHE_OP_READ << 8)
+                      | ((std::uint64_t)PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        };
+        const std::uint32_t types[COUNT] = {
+            PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE,
+            PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE};
+        const std::uint64_t configs[COUNT] = {
+            PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, cache(PERF_COUNT_HW_CACHE_L1D),
+            cache(PERF_COUNT_HW_CACHE_LL), PERF_COUNT_HW_BRANCH_MISSES, cache(PERF_COUNT_HW_CACHE_DTLB)};
+
+        for (int e = 0; e < COUNT; e++) {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = types[e];
+            attr.config = configs[e];
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            fds[e] = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+            if (fds[e] < 0 && reason.empty()) {
+                reason = std::string(name(e)) + ": " + std::strerror(errno);
+            }
+        }
+#else
+        reason = "perf_event_open needs Linux";
+#endif
+    }
+
+    ~PerfCounters() {
+#ifdef PERF_COUNTERS_LINUX
+        for (int fd : fds) {
+            if (fd >= 0) close(fd);
+        }
+#endif
+    }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    bool has(int e) const { return fds[e] >= 0; }
+
+    bool available() const {
+        for (int fd : fds) {
+            if (fd >= 0) return true;
+        }
+        return false;
+    }
+
+    // first event that failed to open and why ("" = all open)
+    const std::string &error() const { return reason; }
+
+    void start() {
+#ifdef PERF_COUNTERS_LINUX
+        for (int fd : fds) {
+            if (fd < 0) continue;
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    // counts since start(); -1 = event unavailable or never scheduled
+    Values stop() {
+        Values v;
+        v.fill(-1);
+#ifdef PERF_COUNTERS_LINUX
+        for (int fd : fds) {
+            if (fd >= 0) ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        }
+        for (int e = 0; e < COUNT; e++) {
+            if (fds[e] < 0) continue;
+            std::uint64_t data[3]; // value, time_enabled, time_running
+            if (read(fds[e], data, sizeof(data)) != (ssize_t)sizeof(data) || data[2] == 0) continue;
+            v[e] = (double)data[0] * ((double)data[1] / (double)data[2]);
+        }
+#endif
+        return v;
+    }
+
+private:
+    std::array<int, COUNT> fds;
+    std::string reason;
+};
+
+#endif
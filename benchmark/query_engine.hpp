@@ -0,0 +1,199 @@
+#ifndef QUERY_ENGINE_HPP
+#define QUERY_ENGINE_HPP
+
+// Dijkstra for many point-to-point / multi-source queries on one Graph.
+//   - the heap (Opt::PairingHeap and its MemoryPool), dist[] and handle[] live as long as the
+//     engine, so a query allocates nothing once the pool has grown
+//   - every dist / handle entry is tagged with the epoch of the query that wrote it; an older tag
+//     reads as "unreached", so a new query costs one epoch++ (plus heap.reset(), O(1)) instead of
+//     an O(V) fill, and only touched vertices are ever written
+//   - a search stops as soon as every target is settled
+//   - distances(pairs) sorts the pairs by source and answers each source group with one search
+// One engine serves one thread at a time.
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "graph.hpp"
+#include "../datastructure/optimize/pairing_heap.hpp"
+
+class QueryEngine {
+public:
+    // same "unreached" value as the dijkstra_* variants
+    static const int INF = 1000000000;
+
+private:
+    struct Item {
+        int dist;
+        int vertex;
+
+        bool operator>(const Item &other) const { return dist > other.dist; }
+        bool operator<(const Item &other) const { return dist < other.dist; }
+    };
+
+    Graph g;
+    Opt::PairingHeap<Item> heap;
+
+    std::vector<int> dist;
+    std::vector<Opt::Node<Item>*> handle;  // nullptr once settled
+    std::vector<std::uint32_t> stamp;      // epoch that last wrote dist / handle
+    std::vector<std::uint32_t> wanted;     // epoch in which the vertex is an unsettled target
+    std::uint32_t epoch = 0;
+
+    std::size_t lastSettled = 0;
+    std::size_t lastTouched = 0;
+
+    void check(int v) const {
+        if (v < 0 || v >= g.V) throw std::out_of_range("QueryEngine: vertex " + std::to_string(v) + " out of range");
+    }
+
+    void begin() {
+        if (++epoch == 0) {
+            // 2^32 queries later: old tags could alias, wipe them once
+            std::fill(stamp.begin(), stamp.end(), 0);
+            std::fill(wanted.begin(), wanted.end(), 0);
+            epoch = 1;
+        }
+        heap.reset();
+        lastSettled = lastTouched = 0;
+    }
+
+    void addSource(int s) {
+        check(s);
+        if (stamp[s] == epoch) return; // duplicate source
+        stamp[s] = epoch;
+        dist[s] = 0;
+        handle[s] = heap.insert({0, s});
+        lastTouched++;
+    }
+
+    // settle vertices until `targets` wanted vertices are settled (targets = 0: until empty)
+    void run(std::size_t targets) {
+        bool all = targets == 0;
+
+        while (!heap.empty()) {
+            int u = heap.deleteMin().vertex;
+            handle[u] = nullptr;
+            lastSettled++;
+
+            if (wanted[u] == epoch) {
+                wanted[u] = 0;
+                if (!all && --targets == 0) return;
+            }
+
+            int du = dist[u];
+            for (long long e = g.offsets[u]; e < g.offsets[u + 1]; e++) {
+                int v = g.to[e];
+                int new_dist = du + g.weight[e];
+
+                if (stamp[v] != epoch) {
+                    stamp[v] = epoch;
+                    dist[v] = new_dist;
+                    handle[v] = heap.insert({new_dist, v});
+                    lastTouched++;
+                } else if (new_dist < dist[v] && handle[v]) {
+                    dist[v] = new_dist;
+                    heap.decreaseKey(handle[v], {new_dist, v});
+                }
+            }
+        }
+    }
+
+    // mark targets of the current query, return how many distinct ones still need settling
+    std::size_t markTargets(const int *targets, std::size_t n) {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < n; i++) {
+            check(targets[i]);
+            if (wanted[targets[i]] != epoch) {
+                wanted[targets[i]] = epoch;
+                count++;
+            }
+        }
+        return count;
+    }
+
+public:
+    explicit QueryEngine(const Graph &graph)
+        : g(graph), dist(graph.V), handle(graph.V, nullptr), stamp(graph.V, 0), wanted(graph.V, 0) {}
+
+    QueryEngine(const QueryEngine&) = delete;
+    QueryEngine& operator=(const QueryEngine&) = delete;
+
+    int vertices() const { return g.V; }
+
+    // vertices settled / touched (inserted at least once) by the last query
+    std::size_t settled() const { return lastSettled; }
+    std::size_t touched() const { return lastTouched; }
+
+    // node pool of the persistent heap (blocks stay allocated between queries)
+    PoolStats poolStats() const { return heap.poolStats(); }
+
+    // distance of v in the last query: exact for targets and settled vertices,
+    // an upper bound for other touched vertices, INF for untouched ones
+    int distanceTo(int v) const {
+        check(v);
+        return stamp[v] == epoch ? dist[v] : INF;
+    }
+
+    // point-to-point query, INF = unreachable
+    int distance(int source, int target) {
+        begin();
+        addSource(source);
+        run(markTargets(&target, 1));
+        return distanceTo(target);
+    }
+
+    // multi-source query: distance from the nearest source
+    // (target = -1: search everything reachable, read the results with distanceTo)
+    int distance(const std::vector<int> &sources, int target) {
+        begin();
+        for (int s : sources) addSource(s);
+        if (target < 0) {
+            run(0);
+            return INF;
+        }
+        run(markTargets(&target, 1));
+        return distanceTo(target);
+    }
+
+    // one-to-many query: out[i] = distance(source, targets[i]), one search
+    void distances(int source, const std::vector<int> &targets, std::vector<int> &out) {
+        begin();
+        addSource(source);
+        if (!targets.empty()) run(markTargets(targets.data(), targets.size()));
+        out.resize(targets.size());
+        for (std::size_t i = 0; i < targets.size(); i++) out[i] = distanceTo(targets[i]);
+    }
+
+    // batched query: out[i] = distance(pairs[i].first, pairs[i].second); pairs that share a
+    // source are answered by one search
+    void distances(const std::vector<std::pair<int, int>> &pairs, std::vector<int> &out) {
+        std::vector<std::size_t> order(pairs.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+            return pairs[a].first < pairs[b].first;
+        });
+
+        out.resize(pairs.size());
+        std::vector<int> group;
+        for (std::size_t i = 0; i < order.size();) {
+            int source = pairs[order[i]].first;
+            std::size_t j = i;
+            group.clear();
+            for (; j < order.size() && pairs[order[j]].first == source; j++) group.push_back(pairs[order[j]].second);
+
+            begin();
+            addSource(source);
+            run(markTargets(group.data(), group.size()));
+            for (std::size_t k = i; k < j; k++) out[order[k]] = distanceTo(pairs[order[k]].second);
+            i = j;
+        }
+    }
+};
+
+#endif
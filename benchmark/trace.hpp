@@ -0,0 +1,225 @@
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+// Heap operation traces:
+//   format       - TraceHeader + count TraceRecord (8 bytes each: op:2 | id:30, int32 key)
+//   TraceWriter  - buffered writer, header is patched on close()
+//   map_trace    - mmap a trace file, records are read in place
+//   TracingHeap  - wraps any heap with insert / decreaseKey / deleteMin and records every call;
+//                  TracingHeap<Heap, false> is just Heap (recording compiled out)
+// Ids are handed out in insert order (0, 1, 2, ...); a deleteMin record carries the key it
+// returned, so a replay can check its results against the recording.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "mapped_file.hpp"
+
+enum TraceOp : std::uint32_t {
+    TRACE_INSERT = 0,       // id = new handle id, key = inserted key
+    TRACE_DECREASE_KEY = 1, // id = handle id, key = new key
+    TRACE_DELETE_MIN = 2    // id = 0, key = returned min key
+};
+
+struct TraceHeader {
+    char magic[8];       // "DSTRACE\1"
+    std::uint64_t count; // records
+    std::uint64_t ids;   // ids handed out by inserts
+};
+
+struct TraceRecord {
+    std::uint32_t opId; // op << 30 | id
+    std::int32_t key;
+
+    static const std::uint32_t ID_MASK = (1u << 30) - 1;
+
+    TraceOp op() const { return static_cast<TraceOp>(opId >> 30); }
+    std::uint32_t id() const { return opId & ID_MASK; }
+};
+
+static_assert(sizeof(TraceRecord) == 8, "TraceRecord must stay 8 bytes");
+
+static const char TRACE_FILE_MAGIC[8] = {'D', 'S', 'T', 'R', 'A', 'C', 'E', 1};
+
+// key recorded for a heap element: the value itself for arithmetic types,
+// specialize for structs (e.g. the benchmark's State records its dist)
+template <typename T>
+struct TraceKey {
+    static std::int32_t get(const T &x) { return static_cast<std::int32_t>(x); }
+};
+
+class TraceWriter {
+private:
+    std::FILE *f = nullptr;
+    std::string path;
+    std::vector<TraceRecord> buffer;
+    std::uint64_t count = 0;
+    std::uint64_t ids = 0;
+
+    static const std::size_t BUFFER_RECORDS = 1 << 16;
+
+    void flush() {
+        if (buffer.empty()) return;
+        if (std::fwrite(buffer.data(), sizeof(TraceRecord), buffer.size(), f) != buffer.size()) {
+            throw std::runtime_error("TraceWriter: write failed for " + path);
+        }
+        buffer.clear();
+    }
+
+    void writeHeader() {
+        TraceHeader h;
+        std::memcpy(h.magic, TRACE_FILE_MAGIC, sizeof(h.magic));
+        h.count = count;
+        h.ids = ids;
+        if (std::fseek(f, 0, SEEK_SET) != 0 || std::fwrite(&h, sizeof(h), 1, f) != 1) {
+            throw std::runtime_error("TraceWriter: write failed for " + path);
+        }
+    }
+
+public:
+    explicit TraceWriter(const std::string &path) : path(path) {
+        f = std::fopen(path.c_str(), "wb");
+        if (!f) throw std::runtime_error("TraceWriter: cannot create " + path);
+        buffer.reserve(BUFFER_RECORDS);
+        writeHeader(); // placeholder, rewritten by close()
+    }
+
+    ~TraceWriter() {
+        try {
+            close();
+        } catch (const std::exception&) {
+            // destructor: a failed final flush leaves a truncated (count = 0) file
+        }
+    }
+
+    TraceWriter(const TraceWriter&) = delete;
+    TraceWriter& operator=(const TraceWriter&) = delete;
+
+    std::uint32_t newId() {
+        if (ids > TraceRecord::ID_MASK) throw std::length_error("TraceWriter: more than 2^30 handles");
+        return static_cast<std::uint32_t>(ids++);
+    }
+
+    void record(TraceOp op, std::uint32_t id, std::int32_t key) {
+        buffer.push_back(TraceRecord{(static_cast<std::uint32_t>(op) << 30) | id, key});
+        count++;
+        if (buffer.size() == BUFFER_RECORDS) flush();
+    }
+
+    std::uint64_t records() const { return count; }
+
+    void close() {
+        if (!f) return;
+        flush();
+        writeHeader();
+        bool ok = std::fclose(f) == 0;
+        f = nullptr;
+        if (!ok) throw std::runtime_error("TraceWriter: close failed for " + path);
+    }
+};
+
+// a mapped trace; records point into the file
+struct Trace {
+    const TraceRecord *records = nullptr;
+    std::uint64_t count = 0;
+    std::uint64_t ids = 0;
+    std::shared_ptr<const void> backing;
+};
+
+inline Trace map_trace(const std::string &path) {
+    MappedFile file = map_file(path, "map_trace");
+
+    TraceHeader h;
+    if (file.size < sizeof(h)) throw std::runtime_error("map_trace: truncated file " + path);
+    std::memcpy(&h, file.data, sizeof(h));
+    if (std::memcmp(h.magic, TRACE_FILE_MAGIC, sizeof(h.magic)) != 0) {
+        throw std::runtime_error("map_trace: not a trace file " + path);
+    }
+    // count bounded by the file size first, so the expected size below cannot overflow
+    if (h.count > (file.size - sizeof(h)) / sizeof(TraceRecord)
+        || file.size != sizeof(h) + h.count * sizeof(TraceRecord)) {
+        throw std::runtime_error("map_trace: size mismatch in " + path);
+    }
+    // ids sizes the replays' per-handle arrays; a writer never hands out more than ID_MASK + 1
+    if (h.ids > (std::uint64_t)TraceRecord::ID_MASK + 1) {
+        throw std::runtime_error("map_trace: too many ids in " + path);
+    }
+
+    Trace t;
+    t.records = reinterpret_cast<const TraceRecord*>(file.data + sizeof(h));
+    t.count = h.count;
+    t.ids = h.ids;
+    t.backing = file.backing;
+
+    // every record indexes those arrays by id: check op and id once here
+    for (std::uint64_t i = 0; i < t.count; i++) {
+        const TraceRecord r = t.records[i];
+        if (r.op() > TRACE_DELETE_MIN || (r.op() != TRACE_DELETE_MIN && r.id() >= t.ids)) {
+            throw std::runtime_error("map_trace: corrupt record in " + path);
+        }
+    }
+    return t;
+}
+
+// recording wrapper: same interface as Heap, every insert / decreaseKey / deleteMin is also
+// written to the attached TraceWriter (nothing is written while none is attached)
+template <typename Heap, bool Enabled = true>
+class TracingHeap : public Heap {
+public:
+    // element / handle types as seen through deleteMin() and insert()
+    using value_type = typename std::decay<decltype(std::declval<Heap&>().deleteMin())>::type;
+    using handle_type = decltype(std::declval<Heap&>().insert(std::declval<value_type>()));
+
+private:
+    TraceWriter *writer = nullptr;
+    std::unordered_map<std::uintptr_t, std::uint32_t> ids; // live handle -> trace id
+
+    static std::uintptr_t bits(handle_type handle) {
+        if constexpr (std::is_pointer<handle_type>::value) return reinterpret_cast<std::uintptr_t>(handle);
+        else return static_cast<std::uintptr_t>(handle);
+    }
+
+public:
+    using Heap::Heap;
+
+    void attach(TraceWriter *w) { writer = w; }
+
+    handle_type insert(value_type key) {
+        handle_type handle = Heap::insert(key);
+        if (writer) {
+            std::uint32_t id = writer->newId();
+            ids[bits(handle)] = id; // a reused node / slot simply gets the new id
+            writer->record(TRACE_INSERT, id, TraceKey<value_type>::get(key));
+        }
+        return handle;
+    }
+
+    void decreaseKey(handle_type handle, value_type newKey) {
+        if (writer) writer->record(TRACE_DECREASE_KEY, ids.at(bits(handle)), TraceKey<value_type>::get(newKey));
+        Heap::decreaseKey(handle, newKey);
+    }
+
+    value_type deleteMin() {
+        value_type result = Heap::deleteMin();
+        if (writer) writer->record(TRACE_DELETE_MIN, 0, TraceKey<value_type>::get(result));
+        return result;
+    }
+};
+
+template <typename Heap>
+class TracingHeap<Heap, false> : public Heap {
+public:
+    using Heap::Heap;
+
+    void attach(TraceWriter*) {}
+};
+
+#endif
@@ -0,0 +1,132 @@
+#ifndef TRACE_REPLAY_HPP
+#define TRACE_REPLAY_HPP
+
+// Replays a recorded Trace (trace.hpp) through a heap, straight from the mapped records.
+//   replay_addressable<A> - heaps with handles: insert keeps the handle of trace id, decreaseKey
+//                           uses it (Opt / Origin / Compact pairing heaps, DaryHeap, RadixHeap)
+//   replay_lazy<A>        - heaps without decreaseKey (BinaryHeap, std::priority_queue): a
+//                           decreaseKey pushes a second entry and deleteMin skips stale ones
+// Every deleteMin result goes to `out`; replay_timed compares it with the keys the
+// recording returned, so all heaps are checked against the same ground truth.
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "trace.hpp"
+
+// element type of the replays: key + trace id (compared by key only)
+struct TraceItem {
+    std::int32_t key;
+    std::uint32_t id;
+
+    bool operator>(const TraceItem &other) const { return key > other.key; }
+    bool operator<(const TraceItem &other) const { return key < other.key; }
+};
+
+template <typename A>
+void replay_addressable(const Trace &t, std::vector<std::int32_t> &out) {
+    typename A::Heap heap;
+    std::vector<typename A::Handle> handles(t.ids);
+    std::size_t k = 0;
+
+    for (std::uint64_t i = 0; i < t.count; i++) {
+        const TraceRecord r = t.records[i];
+        switch (r.op()) {
+        case TRACE_INSERT:
+            handles[r.id()] = A::push(heap, TraceItem{r.key, r.id()});
+            break;
+        case TRACE_DECREASE_KEY:
+            A::decrease(heap, handles[r.id()], TraceItem{r.key, r.id()});
+            break;
+        case TRACE_DELETE_MIN:
+            out[k++] = A::pop(heap);
+            break;
+        }
+    }
+}
+
+template <typename A>
+void replay_lazy(const Trace &t, std::vector<std::int32_t> &out) {
+    typename A::Heap heap;
+    std::vector<std::int32_t> current(t.ids);
+    std::vector<char> alive(t.ids, 0);
+    std::size_t k = 0;
+
+    for (std::uint64_t i = 0; i < t.count; i++) {
+        const TraceRecord r = t.records[i];
+        switch (r.op()) {
+        case TRACE_INSERT:
+            alive[r.id()] = 1;
+            [[fallthrough]]; // both push (key, id) and remember it as the live key
+        case TRACE_DECREASE_KEY:
+            current[r.id()] = r.key;
+            A::push(heap, TraceItem{r.key, r.id()});
+            break;
+        case TRACE_DELETE_MIN:
+            while (true) {
+                if (heap.empty()) throw std::runtime_error("replay_lazy: deleteMin on an empty heap");
+                TraceItem top = A::pop(heap);
+                if (alive[top.id] && current[top.id] == top.key) {
+                    alive[top.id] = 0;
+                    out[k++] = top.key;
+                    break;
+                }
+            }
+            break;
+        }
+    }
+}
+
+struct ReplayResult {
+    std::string heap;
+    std::vector<double> ms; // one sample per repetition
+    bool ok = true;
+    std::string note;       // first mismatch / why the heap was skipped
+};
+
+// time `reps` replays of t with fn and check every deleteMin against the recorded key
+inline ReplayResult replay_timed(const std::string &name, const Trace &t, int reps,
+                                 const std::function<void(const Trace&, std::vector<std::int32_t>&)> &fn) {
+    ReplayResult res;
+    res.heap = name;
+
+    std::vector<std::int32_t> expected;
+    for (std::uint64_t i = 0; i < t.count; i++) {
+        const TraceRecord r = t.records[i];
+        if (r.op() == TRACE_DELETE_MIN) expected.push_back(r.key);
+        else if (r.op() > TRACE_DELETE_MIN || r.id() >= t.ids) {
+            throw std::runtime_error("replay_timed: corrupt record #" + std::to_string(i));
+        }
+    }
+    std::vector<std::int32_t> out(expected.size());
+
+    try {
+        for (int rep = 0; rep < reps; rep++) {
+            auto start = std::chrono::steady_clock::now();
+            fn(t, out);
+            auto end = std::chrono::steady_clock::now();
+            res.ms.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+        }
+    } catch (const std::exception &e) {
+        res.ok = false;
+        res.note = e.what();
+        return res;
+    }
+
+    for (std::size_t i = 0; i < expected.size(); i++) {
+        if (out[i] != expected[i]) {
+            res.ok = false;
+            res.note = "deleteMin #" + std::to_string(i) + " returned " + std::to_string(out[i])
+                     + ", trace has " + std::to_string(expected[i]);
+            break;
+        }
+    }
+    return res;
+}
+
+#endif
@@ -1,4 +1,5 @@
 #include "./optimize/pairing_heap.hpp"
+#include "./optimize/compact_pairing_heap.hpp"
 
 #include <iostream>
 #include <vector>
@@ -30,6 +31,20 @@ int main() {
         sph.insert("Apple");
         sph.insert("Cherry");
         std::cout << "Min: " << sph.getMin() << " (Expected: Apple)" << std::endl;
+        sph.emplace(3, 'A'); // std::string(3, 'A') built inside the node
+        std::string top = sph.deleteMin(); // moved out, no copy
+        std::cout << "Min after emplace: " << top << " (Expected: AAA)" << std::endl;
+
+        // 4. 測試 compact (32-bit index handles)
+        std::cout << "\n--- Compact Test ---" << std::endl;
+        Opt::CompactPairingHeap<int> cph;
+        cph.insert(10);
+        auto h = cph.insert(30);
+        cph.insert(20);
+        cph.decreaseKey(h, 1);
+        std::cout << "Min: " << cph.getMin() << " (Expected: 1)" << std::endl;
+        cph.deleteMin();
+        std::cout << "Min after delete: " << cph.getMin() << " (Expected: 10)" << std::endl;
 
     } catch (const std::exception& e) {
         std::cerr << "Error: " << e.what() << std::endl;
@@ -0,0 +1,18 @@
+#ifndef COMPACT_PAIRING_HEAP_HPP
+#define COMPACT_PAIRING_HEAP_HPP
+
+#include "keyed_pairing_heap.hpp"
+
+namespace Opt {
+    // 32-bit links instead of 64-bit pointers:
+    // sizeof(CompactNode<State>) == 20 (vs 32 for Node<State>)
+    template<typename T>
+    using CompactNode = KeyedNode<T>;
+
+    // key-only index-linked pairing heap, keys ordered with operator> like PairingHeap:
+    // insert(key) -> Handle, decreaseKey(handle, key), getMin() / deleteMin() give the key
+    template<typename T, typename Pairing = TwoPass>
+    using CompactPairingHeap = KeyedPairingHeap<T, void, GreaterOrder<T>, Pairing>;
+}
+
+#endif
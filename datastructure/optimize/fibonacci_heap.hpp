@@ -0,0 +1,109 @@
+#ifndef FIBONACCI_HEAP_HPP
+#define FIBONACCI_HEAP_HPP
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "memory_pool.hpp"
+
+namespace Opt {
+    // roots and every child list are circular doubly linked lists (left / right)
+    template<typename T>
+    struct FibNode {
+        T key;
+        FibNode<T> *parent;
+        FibNode<T> *child;
+        FibNode<T> *left;
+        FibNode<T> *right;
+        unsigned degree;
+        bool marked; // lost a child since it became a child itself
+
+        template <typename... Args>
+        explicit FibNode(std::in_place_t, Args&&... args)
+            : key(std::forward<Args>(args)...), parent(nullptr), child(nullptr),
+              left(this), right(this), degree(0), marked(false) {}
+    };
+
+    // Fibonacci heap (Fredman & Tarjan): same handle API as PairingHeap
+    //   insert / meld / decreaseKey O(1) amortized, deleteMin O(log n) amortized
+    template<typename T>
+    class FibonacciHeap {
+    private:
+        FibNode<T> *minNode;
+        std::size_t sz;
+
+        MemoryPool<FibNode<T>> pool;
+
+        // deleteMin scratch, kept between calls: roots to consolidate, tree per degree
+        std::vector<FibNode<T>*> roots;
+        std::vector<FibNode<T>*> byDegree;
+
+        // splice the circular list starting at x into the root list
+        void addRoots(FibNode<T> *x);
+
+        // make y a child of x (both roots, y->key >= x->key)
+        static void link(FibNode<T> *y, FibNode<T> *x);
+
+        // link roots of equal degree until all degrees differ, then rebuild root list + min
+        void consolidate();
+
+        // decrease-key helpers: move x from y's child list to the root list, then walk up
+        void cut(FibNode<T> *x, FibNode<T> *y);
+        void cascadingCut(FibNode<T> *y);
+
+        void deleteAll();
+    public:
+        FibonacciHeap() : minNode(nullptr), sz(0) {}
+        ~FibonacciHeap() { clear(); }
+
+        bool empty() const { return minNode == nullptr; }
+        std::size_t size() const { return sz; }
+
+        PoolStats poolStats() const { return pool.stats(); }
+
+        const T &getMin() const {
+            if (!minNode) throw std::runtime_error("FibonacciHeap::getMin(): empty heap");
+            return minNode->key;
+        }
+
+        // insert: return handle for decreaseKey
+        FibNode<T> *insert(const T &key) { return emplace(key); }
+        FibNode<T> *insert(T &&key) { return emplace(std::move(key)); }
+
+        template <typename... Args>
+        FibNode<T> *emplace(Args&&... args);
+
+        // meld: consume other (other becomes empty)
+        void meld(FibonacciHeap& other);
+
+        // decrease-key: newKey must be <= node->key
+        void decreaseKey(FibNode<T> *node, T newKey);
+
+        // delete-min: remove min and return its value
+        T deleteMin();
+
+        void clear() {
+            deleteAll();
+            minNode = nullptr;
+            sz = 0;
+        }
+
+        // drop all nodes at once (O(1) when T is trivially destructible, see PairingHeap::reset)
+        void reset() {
+            if constexpr (std::is_trivially_destructible<T>::value) {
+                pool.reset();
+                minNode = nullptr;
+                sz = 0;
+            } else {
+                clear();
+            }
+        }
+    };
+
+    #include "fibonacci_heap.ipp"
+}
+
+#endif
@@ -0,0 +1,195 @@
+#ifdef __INTELLISENSE__
+#include "fibonacci_heap.hpp"
+#endif
+
+using namespace Opt;
+
+template <typename T>
+void FibonacciHeap<T>::addRoots(FibNode<T> *x) {
+    if (!minNode) {
+        minNode = x;
+        return;
+    }
+
+    // splice two circular lists: minNode ... | x ... x->left
+    FibNode<T> *xLast = x->left;
+    FibNode<T> *next = minNode->right;
+    minNode->right = x;
+    x->left = minNode;
+    xLast->right = next;
+    next->left = xLast;
+}
+
+template <typename T>
+void FibonacciHeap<T>::link(FibNode<T> *y, FibNode<T> *x) {
+    y->parent = x;
+    y->marked = false;
+    if (!x->child) {
+        y->left = y->right = y;
+        x->child = y;
+    } else {
+        FibNode<T> *c = x->child;
+        y->right = c->right;
+        y->left = c;
+        c->right->left = y;
+        c->right = y;
+    }
+    x->degree++;
+}
+
+template <typename T>
+template <typename... Args>
+FibNode<T> *FibonacciHeap<T>::emplace(Args&&... args) {
+    FibNode<T> *node = pool.allocate(std::in_place, std::forward<Args>(args)...);
+    addRoots(node);
+    if (minNode->key > node->key) minNode = node;
+    sz++;
+    return node;
+}
+
+template <typename T>
+void FibonacciHeap<T>::meld(FibonacciHeap<T>& other) {
+    if (other.empty()) return;
+
+    FibNode<T> *otherMin = other.minNode;
+    addRoots(otherMin);
+    if (minNode->key > otherMin->key) minNode = otherMin;
+    sz += other.sz;
+
+    // other's nodes now belong to this heap, so this pool takes over their blocks
+    pool.absorb(other.pool);
+
+    other.minNode = nullptr;
+    other.sz = 0;
+}
+
+template <typename T>
+void FibonacciHeap<T>::consolidate() {
+    roots.clear();
+    FibNode<T> *x = minNode;
+    do {
+        roots.push_back(x);
+        x = x->right;
+    } while (x != minNode);
+
+    for (FibNode<T> *w : roots) {
+        x = w;
+        unsigned d = x->degree;
+        while (d < byDegree.size() && byDegree[d]) {
+            FibNode<T> *y = byDegree[d];
+            if (x->key > y->key) std::swap(x, y);
+            link(y, x);
+            byDegree[d++] = nullptr;
+        }
+        if (d >= byDegree.size()) byDegree.resize(d + 1, nullptr);
+        byDegree[d] = x;
+    }
+
+    // surviving trees form the new root list
+    minNode = nullptr;
+    for (FibNode<T> *&t : byDegree) {
+        if (!t) continue;
+        t->left = t->right = t;
+        addRoots(t);
+        if (minNode->key > t->key) minNode = t;
+        t = nullptr;
+    }
+}
+
+template <typename T>
+T FibonacciHeap<T>::deleteMin() {
+    if (this->empty()) throw std::runtime_error("FibonacciHeap::deleteMin(): empty heap");
+
+    FibNode<T> *z = minNode;
+    T result = std::move(z->key); // z is freed below, nothing reads its key again
+
+    // children become roots
+    if (FibNode<T> *c = z->child) {
+        FibNode<T> *x = c;
+        do {
+            x->parent = nullptr;
+            x = x->right;
+        } while (x != c);
+        addRoots(c);
+    }
+
+    // unlink z from the root list
+    if (z->right == z) {
+        minNode = nullptr;
+    } else {
+        z->left->right = z->right;
+        z->right->left = z->left;
+        minNode = z->right;
+        consolidate();
+    }
+
+    pool.deallocate(z);
+    sz--;
+    return result;
+}
+
+template <typename T>
+void FibonacciHeap<T>::cut(FibNode<T> *x, FibNode<T> *y) {
+    if (x->right == x) {
+        y->child = nullptr;
+    } else {
+        if (y->child == x) y->child = x->right;
+        x->left->right = x->right;
+        x->right->left = x->left;
+    }
+    y->degree--;
+
+    x->left = x->right = x;
+    x->parent = nullptr;
+    x->marked = false;
+    addRoots(x);
+}
+
+template <typename T>
+void FibonacciHeap<T>::cascadingCut(FibNode<T> *y) {
+    while (FibNode<T> *z = y->parent) {
+        if (!y->marked) {
+            y->marked = true;
+            return;
+        }
+        cut(y, z);
+        y = z;
+    }
+}
+
+template <typename T>
+void FibonacciHeap<T>::decreaseKey(FibNode<T> *node, T newKey) {
+    if (newKey > node->key) throw std::runtime_error("FibonacciHeap::decreaseKey: newKey must be <= current key");
+
+    node->key = std::move(newKey);
+
+    FibNode<T> *y = node->parent;
+    if (y && y->key > node->key) {
+        cut(node, y);
+        cascadingCut(y);
+    }
+    if (minNode->key > node->key) minNode = node;
+}
+
+template <typename T>
+void FibonacciHeap<T>::deleteAll() {
+    if (!minNode) return;
+
+    // open the root circle into a singly linked work list (through `right`); every freed node
+    // pushes its opened child circle in front of the rest -> O(n), no recursion, no stack
+    FibNode<T> *work = minNode->right;
+    minNode->right = nullptr;
+
+    while (work) {
+        FibNode<T> *x = work;
+        work = x->right;
+
+        if (FibNode<T> *c = x->child) {
+            FibNode<T> *last = c->left;
+            last->right = work;
+            work = c;
+        }
+
+        pool.deallocate(x);
+    }
+}
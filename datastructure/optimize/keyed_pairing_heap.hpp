@@ -0,0 +1,145 @@
+#ifndef KEYED_PAIRING_HEAP_HPP
+#define KEYED_PAIRING_HEAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "pairing_policy.hpp"
+
+namespace Opt {
+    // hot part of a node: key + 32-bit links, everything merge / cut / pairing touches
+    // (sizeof(KeyedNode<State>) == 20 vs 32 for Node<State>)
+    template<typename Key>
+    struct KeyedNode {
+        Key key;
+        std::uint32_t child;
+        std::uint32_t sibling;
+        std::uint32_t prev;
+    };
+
+    // Compare built from operator> alone: a comes out before b iff b > a
+    // (what the element heaps of this repo provide, see CompactPairingHeap)
+    template<typename T>
+    struct GreaterOrder {
+        bool operator()(const T& a, const T& b) const { return b > a; }
+    };
+
+    // index-linked pairing heap: all nodes live in one contiguous array, handles are 32-bit indices.
+    // With a Payload, it is split off the node:
+    // nodes[h] (key + links) and payloads[h] are parallel arrays indexed by the handle, so
+    // comparisons and relinking never load a payload; payloads are only touched by
+    // insert, getMin and deleteMin.
+    // Payload = void: key-only heap, getMin / deleteMin return the key (CompactPairingHeap).
+    // Compare(a, b) == true: key a comes out before key b (std::less = min-heap)
+    // Pairing: TwoPass (default), MultiPass, FrontToBack or AuxTwoPass (see pairing_policy.hpp)
+    template<typename Key, typename Payload, typename Compare = std::less<Key>, typename Pairing = TwoPass>
+    class KeyedPairingHeap : private Compare {
+    public:
+        using Handle = std::uint32_t;
+        static constexpr Handle NIL = 0xFFFFFFFFu;
+
+        // what getMin / deleteMin hand out
+        using Value = std::conditional_t<std::is_void<Payload>::value, Key, Payload>;
+
+    private:
+        struct NoPayload {};
+        using PayloadArg = std::conditional_t<std::is_void<Payload>::value, NoPayload, Payload>;
+
+        std::vector<KeyedNode<Key>> nodes; // freed slots are chained through `sibling`
+        std::vector<PayloadArg> payloads;  // payloads[h] belongs to nodes[h] (unused when Payload is void)
+        Handle freeHead;
+
+        Handle root;
+        std::size_t sz;
+
+        // how the Pairing policy follows index links (see pairing_policy.hpp)
+        struct Links {
+            std::vector<KeyedNode<Key>> *nodes;
+
+            static Handle nil() { return NIL; }
+            Handle &sibling(Handle x) const { return (*nodes)[x].sibling; }
+            Handle child(Handle x) const { return (*nodes)[x].child; }
+            const KeyedNode<Key> *addr(Handle x) const { return x == NIL ? nullptr : &(*nodes)[x]; }
+        };
+
+        bool before(const Key& a, const Key& b) const { return Compare::operator()(a, b); }
+
+        Handle allocate(const Key& key, PayloadArg&& payload);
+        void deallocate(Handle x);
+
+        // meld two heaps rooted at a and b, return new root
+        Handle merge(Handle a, Handle b);
+
+        // delete-min helper: combine sibling list with the Pairing policy (iterative)
+        Handle twoPassMerge(Handle firstSibling);
+
+        // auxiliary-root-list helper: multipass merge on sibling list
+        Handle multiPassMerge(Handle firstSibling);
+
+        // auxiliary-root-list helper: add standalone root x to the list hanging off root's sibling
+        void pushRoot(Handle x);
+
+        // decrease-key helper: cut x from its current position (x becomes a standalone root)
+        void cut(Handle x);
+    public:
+        explicit KeyedPairingHeap(const Compare& comp = Compare())
+            : Compare(comp), freeHead(NIL), root(NIL), sz(0) {}
+
+        bool empty() const { return root == NIL; }
+        std::size_t size() const { return sz; }
+
+        // key / payload (key when Payload is void) of the min
+        const Key& minKey() const {
+            if(root == NIL) throw std::runtime_error("KeyedPairingHeap::minKey(): empty heap");
+            return nodes[root].key;
+        }
+
+        const Value& getMin() const {
+            if(root == NIL) throw std::runtime_error("KeyedPairingHeap::getMin(): empty heap");
+            if constexpr (std::is_void<Payload>::value) return nodes[root].key;
+            else return payloads[root];
+        }
+
+        // current key of a live handle
+        const Key& key(Handle node) const { return nodes[node].key; }
+
+        // insert: return handle for decreaseKey
+        Handle insert(const Key& key, PayloadArg payload);
+
+        // key-only insert (Payload = void)
+        Handle insert(const Key& key) {
+            static_assert(std::is_void<Payload>::value, "KeyedPairingHeap::insert: payload required");
+            return insert(key, PayloadArg());
+        }
+
+        // decrease-key: newKey must not come after the current key
+        void decreaseKey(Handle node, const Key& newKey);
+
+        // delete-min: remove root, move its payload (or key) out
+        Value deleteMin();
+
+        // pre-size the arrays (handles stay valid across growth anyway)
+        void reserve(std::size_t n) {
+            nodes.reserve(n);
+            if constexpr (!std::is_void<Payload>::value) payloads.reserve(n);
+        }
+
+        // free all nodes (keeps capacity)
+        void clear() {
+            nodes.clear();
+            payloads.clear();
+            freeHead = NIL;
+            root = NIL;
+            sz = 0;
+        }
+    };
+
+    #include "keyed_pairing_heap.ipp"
+}
+
+#endif
@@ -0,0 +1,172 @@
+#ifdef __INTELLISENSE__
+#include "keyed_pairing_heap.hpp"
+#endif
+
+using namespace Opt;
+
+template <typename Key, typename Payload, typename Compare, typename Pairing>
+typename KeyedPairingHeap<Key, Payload, Compare, Pairing>::Handle
+KeyedPairingHeap<Key, Payload, Compare, Pairing>::allocate(const Key& key, PayloadArg&& payload) {
+    Handle x;
+
+    if (freeHead != NIL) {
+        x = freeHead;
+        freeHead = nodes[x].sibling;
+        nodes[x] = KeyedNode<Key>{key, NIL, NIL, NIL};
+        if constexpr (!std::is_void<Payload>::value) payloads[x] = std::move(payload);
+    } else {
+        if (nodes.size() >= NIL) throw std::length_error("KeyedPairingHeap: too many nodes for 32-bit handles");
+        x = static_cast<Handle>(nodes.size());
+        nodes.push_back(KeyedNode<Key>{key, NIL, NIL, NIL});
+        if constexpr (!std::is_void<Payload>::value) payloads.push_back(std::move(payload));
+    }
+
+    return x;
+}
+
+template <typename Key, typename Payload, typename Compare, typename Pairing>
+void KeyedPairingHeap<Key, Payload, Compare, Pairing>::deallocate(Handle x) {
+    nodes[x].sibling = freeHead;
+    freeHead = x;
+}
+
+template <typename Key, typename Payload, typename Compare, typename Pairing>
+typename KeyedPairingHeap<Key, Payload, Compare, Pairing>::Handle
+KeyedPairingHeap<Key, Payload, Compare, Pairing>::merge(Handle a, Handle b) {
+    if(a == NIL) return b;
+    if(b == NIL) return a;
+
+    if(before(nodes[b].key, nodes[a].key)) {
+        Handle tmp = a;
+        a = b; b = tmp;
+    }
+
+    KeyedNode<Key> &na = nodes[a];
+    KeyedNode<Key> &nb = nodes[b];
+
+    nb.prev = a;
+    nb.sibling = na.child;
+    if (na.child != NIL) nodes[na.child].prev = b;
+    na.child = b;
+
+    return a;
+}
+
+template <typename Key, typename Payload, typename Compare, typename Pairing>
+typename KeyedPairingHeap<Key, Payload, Compare, Pairing>::Handle
+KeyedPairingHeap<Key, Payload, Compare, Pairing>::insert(const Key& key, PayloadArg payload) {
+    Handle node = allocate(key, std::move(payload));
+
+    if constexpr (Pairing::auxiliary) {
+        pushRoot(node);
+    } else {
+        root = merge(root, node);
+    }
+    sz++;
+    return node;
+}
+
+template <typename Key, typename Payload, typename Compare, typename Pairing>
+typename KeyedPairingHeap<Key, Payload, Compare, Pairing>::Handle
+KeyedPairingHeap<Key, Payload, Compare, Pairing>::twoPassMerge(Handle firstSibling) {
+    return Pairing::combine(firstSibling, Links{&nodes}, [this](Handle a, Handle b) { return merge(a, b); });
+}
+
+template <typename Key, typename Payload, typename Compare, typename Pairing>
+typename KeyedPairingHeap<Key, Payload, Compare, Pairing>::Handle
+KeyedPairingHeap<Key, Payload, Compare, Pairing>::multiPassMerge(Handle firstSibling) {
+    return MultiPass::combine(firstSibling, Links{&nodes}, [this](Handle a, Handle b) { return merge(a, b); });
+}
+
+template <typename Key, typename Payload, typename Compare, typename Pairing>
+void KeyedPairingHeap<Key, Payload, Compare, Pairing>::pushRoot(Handle x) {
+    if (root == NIL) {
+        root = x;
+        return;
+    }
+
+    if (before(nodes[x].key, nodes[root].key)) {
+        // x becomes the new min, old root moves to the front of the root list
+        nodes[x].sibling = root;
+        nodes[root].prev = x;
+        root = x;
+        return;
+    }
+
+    Handle rest = nodes[root].sibling;
+    nodes[x].prev = root;
+    nodes[x].sibling = rest;
+    if (rest != NIL) nodes[rest].prev = x;
+    nodes[root].sibling = x;
+}
+
+template <typename Key, typename Payload, typename Compare, typename Pairing>
+typename KeyedPairingHeap<Key, Payload, Compare, Pairing>::Value
+KeyedPairingHeap<Key, Payload, Compare, Pairing>::deleteMin() {
+    if(this->empty()) throw std::runtime_error("KeyedPairingHeap::deleteMin(): empty heap");
+
+    Handle oldRoot = root;
+    Value result = [&]() -> Value {
+        if constexpr (std::is_void<Payload>::value) return std::move(nodes[root].key);
+        else return std::move(payloads[root]);
+    }();
+    Handle children = nodes[root].child;
+
+    if (children != NIL) {
+        nodes[children].prev = NIL;
+    }
+
+    if constexpr (Pairing::auxiliary) {
+        Handle aux = nodes[root].sibling;
+        if (aux != NIL) nodes[aux].prev = NIL;
+
+        root = merge(multiPassMerge(aux), twoPassMerge(children));
+    } else {
+        root = twoPassMerge(children);
+    }
+
+    deallocate(oldRoot);
+    sz--;
+
+    if (root != NIL) {
+        nodes[root].prev = NIL;
+    }
+
+    return result;
+}
+
+template <typename Key, typename Payload, typename Compare, typename Pairing>
+void KeyedPairingHeap<Key, Payload, Compare, Pairing>::cut(Handle x) {
+    Handle previous = nodes[x].prev;
+    Handle nextSibling = nodes[x].sibling;
+
+    if (nextSibling != NIL) {
+        nodes[nextSibling].prev = previous;
+    }
+
+    if (nodes[previous].child == x){
+        nodes[previous].child = nextSibling;
+    } else {
+        nodes[previous].sibling = nextSibling;
+    }
+
+    nodes[x].prev = NIL;
+    nodes[x].sibling = NIL;
+}
+
+template <typename Key, typename Payload, typename Compare, typename Pairing>
+void KeyedPairingHeap<Key, Payload, Compare, Pairing>::decreaseKey(Handle node, const Key& newKey) {
+    if (before(nodes[node].key, newKey)) throw std::runtime_error("KeyedPairingHeap::decreaseKey: newKey must not come after current key");
+
+    nodes[node].key = newKey;
+
+    if (node == root) return;
+
+    cut(node);
+
+    if constexpr (Pairing::auxiliary) {
+        pushRoot(node);
+    } else {
+        root = merge(root, node);
+    }
+}
@@ -3,71 +3,300 @@
 
 #include <vector>
 #include <cstddef>
+#include <new>
+#include <utility>
+#include <algorithm>
+
+#include "pool_backend.hpp"
+
+// counters snapshot (see MemoryPool::stats())
+struct PoolStats {
+    std::size_t live;          // objects currently allocated
+    std::size_t peak;          // max live objects ever
+    std::size_t blocks;        // blocks currently held
+    std::size_t bytesReserved; // bytes currently held (blocks * BlockSize * slot size)
+};
+
+// slot order of allocate():
+//   ReuseFirst (default): last freed slot first (LIFO free list), bump region only when it is empty
+//   FreshFirst: bump region first, so consecutive allocations get adjacent slots; the free list
+//               is drained only when no untouched slot is left, a new block only when both are
+//               empty (same footprint bound as ReuseFirst)
+struct ReuseFirst { static constexpr bool fresh = false; };
+struct FreshFirst { static constexpr bool fresh = true; };
+
+// Backend: where blocks come from, NewBackend (default, ::operator new) or
+// HugePageBackend / NumaHugePageBackend (mmap regions backed by huge pages, see pool_backend.hpp)
+template <typename T, std::size_t BlockSize = 4096, typename Order = ReuseFirst, typename Backend = NewBackend>
+class MemoryPool : private Backend {
+    static_assert(BlockSize > 0, "MemoryPool: BlockSize must be > 0");
 
-template <typename T>
-class MemoryPool {
 private:
+    // a freed slot stores the next free slot in its own bytes (intrusive free list)
+    union Slot {
+        Slot *next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
 
-    static const size_t BLOCK_SIZE = 4096;
+    std::vector<Slot*> blocks;
 
-    std::vector<T*> blocks;
+    // freeTail is the last slot of freeList (only meaningful while freeList != nullptr),
+    // so absorb() can splice two free lists in O(1)
+    Slot *freeList;
+    Slot *freeTail;
 
-    std::vector<T*> freeList;
+    // bump region inside the current block, blocks[nextBlock..] are still untouched
+    Slot *bumpCur;
+    Slot *bumpEnd;
+    std::size_t nextBlock;
 
-    size_t currentBlockIndex;
+    // never carved ranges [first, second) left over by absorb() (each ends its block),
+    // used up by the bump region before the next untouched block
+    std::vector<std::pair<Slot*, Slot*>> pending;
+
+    std::size_t liveCount;
+    std::size_t peakCount;
 
     void expand() {
-        T* newBlock = static_cast<T*>(::operator new(BLOCK_SIZE * sizeof(T)));
+        Slot* newBlock = static_cast<Slot*>(Backend::allocate(BlockSize * sizeof(Slot)));
         blocks.push_back(newBlock);
-        currentBlockIndex = 0;
     }
 
-public:
-    MemoryPool() {
-        currentBlockIndex = BLOCK_SIZE; // firstime allocate expand
+    // move the bump region to the next pending range or untouched block (allocate one if needed)
+    void nextBumpBlock() {
+        if (!pending.empty()) {
+            bumpCur = pending.back().first;
+            bumpEnd = pending.back().second;
+            pending.pop_back();
+            return;
+        }
+        if (nextBlock >= blocks.size()) {
+            expand();
+        }
+        bumpCur = blocks[nextBlock++];
+        bumpEnd = bumpCur + BlockSize;
     }
 
+public:
+    MemoryPool()
+        : freeList(nullptr), freeTail(nullptr), bumpCur(nullptr), bumpEnd(nullptr), nextBlock(0),
+          liveCount(0), peakCount(0) {}
+
+    MemoryPool(const MemoryPool&) = delete;
+    MemoryPool& operator=(const MemoryPool&) = delete;
+
     ~MemoryPool() {
-        // release all
-        for (T* block : blocks) {
-            ::operator delete(block);
-        }
+        release();
     }
 
     // exchange new
     template <typename... Args>
     T* allocate(Args&&... args) {
-        T* ptr = nullptr;
+        Slot* slot = nullptr;
 
-        if (!freeList.empty()) {
-            ptr = freeList.back();
-            freeList.pop_back();
-        } 
+        if constexpr (Order::fresh) {
+            if (bumpCur == bumpEnd && (!pending.empty() || nextBlock < blocks.size() || !freeList)) {
+                nextBumpBlock();
+            }
+            if (bumpCur != bumpEnd) {
+                slot = bumpCur++;
+            } else {
+                slot = freeList;
+                freeList = slot->next;
+            }
+        }
+        else if (freeList) {
+            slot = freeList;
+            freeList = slot->next;
+        }
         else {
-            if (currentBlockIndex >= BLOCK_SIZE) {
-                expand();
+            if (bumpCur == bumpEnd) {
+                nextBumpBlock();
             }
-            ptr = blocks.back() + currentBlockIndex;
-            currentBlockIndex++;
+            slot = bumpCur++;
+        }
+
+        T* ptr = new(slot->storage) T(std::forward<Args>(args)...);
+
+        if (++liveCount > peakCount) peakCount = liveCount;
+        return ptr;
+    }
+
+    // like allocate, but always carves from the bump region (free list untouched),
+    // so consecutive calls return adjacent slots up to the end of a block
+    template <typename... Args>
+    T* allocateFresh(Args&&... args) {
+        if (bumpCur == bumpEnd) {
+            nextBumpBlock();
         }
+        Slot* slot = bumpCur++;
 
-        new(ptr) T(std::forward<Args>(args)...);
+        T* ptr = new(slot->storage) T(std::forward<Args>(args)...);
+
+        if (++liveCount > peakCount) peakCount = liveCount;
         return ptr;
     }
 
     void deallocate(T* ptr) {
         if (!ptr) return;
-        
+
         ptr->~T();
 
-        freeList.push_back(ptr);
+        Slot* slot = reinterpret_cast<Slot*>(ptr);
+        if (!freeList) freeTail = slot;
+        slot->next = freeList;
+        freeList = slot;
+        liveCount--;
     }
-    
-    void reserve(size_t n) {
-        while (blocks.size() * BLOCK_SIZE < n) {
+
+    // make sure at least n objects fit without another ::operator new
+    void reserve(std::size_t n) {
+        while (blocks.size() * BlockSize < n) {
             expand();
         }
     }
+
+    // take over every block of other (other ends up empty);
+    // objects allocated from other stay valid and are now owned by this pool.
+    // O(1) apart from appending other's block / pending vectors: nothing is walked slot by slot
+    void absorb(MemoryPool& other) {
+        if (this == &other || other.blocks.empty()) return;
+
+        // other's blocks are appended; its carved ones are swapped into our carved prefix
+        // (block order only matters to shrink_to_fit, which sorts)
+        std::size_t base = blocks.size();
+        blocks.insert(blocks.end(), other.blocks.begin(), other.blocks.end());
+        for (std::size_t i = 0; i < other.nextBlock; i++) {
+            std::swap(blocks[nextBlock++], blocks[base + i]);
+        }
+
+        // unused tail of other's bump block is carved later, like its own pending ranges
+        pending.insert(pending.end(), other.pending.begin(), other.pending.end());
+        if (other.bumpCur != other.bumpEnd) {
+            pending.push_back({other.bumpCur, other.bumpEnd});
+        }
+
+        if (other.freeList) {
+            other.freeTail->next = freeList;
+            if (!freeList) freeTail = other.freeTail;
+            freeList = other.freeList;
+        }
+
+        liveCount += other.liveCount;
+        if (liveCount > peakCount) peakCount = liveCount;
+
+        Backend::absorb(other);
+
+        other.blocks.clear();
+        other.pending.clear();
+        other.freeList = other.freeTail = nullptr;
+        other.bumpCur = other.bumpEnd = nullptr;
+        other.nextBlock = 0;
+        other.liveCount = 0;
+    }
+
+    // give every block with no live object back to the backend
+    void shrink_to_fit() {
+        if (liveCount == 0) {
+            release();
+            return;
+        }
+
+        // free slots per block = free-list slots + never carved slots
+        std::vector<std::pair<Slot*, std::size_t>> order; // (block start, index in blocks)
+        order.reserve(blocks.size());
+        for (std::size_t i = 0; i < blocks.size(); i++) order.push_back({blocks[i], i});
+        std::sort(order.begin(), order.end());
+
+        auto blockOf = [&](Slot* slot) {
+            auto it = std::upper_bound(order.begin(), order.end(), std::make_pair(slot, blocks.size()));
+            return (it - 1)->second;
+        };
+
+        std::vector<std::size_t> freeSlots(blocks.size(), 0);
+        for (std::size_t i = nextBlock; i < blocks.size(); i++) freeSlots[i] = BlockSize;
+        if (bumpCur != bumpEnd) freeSlots[blockOf(bumpCur)] += bumpEnd - bumpCur;
+        for (const auto& range : pending) freeSlots[blockOf(range.first)] += range.second - range.first;
+
+        for (Slot* s = freeList; s; s = s->next) freeSlots[blockOf(s)]++;
+
+        std::vector<bool> drop(blocks.size());
+        bool anyDrop = false;
+        for (std::size_t i = 0; i < blocks.size(); i++) {
+            drop[i] = (freeSlots[i] == BlockSize);
+            anyDrop = anyDrop || drop[i];
+        }
+        if (!anyDrop) return;
+
+        // unlink free slots living in dropped blocks
+        Slot** link = &freeList;
+        freeTail = nullptr;
+        while (*link) {
+            if (drop[blockOf(*link)]) *link = (*link)->next;
+            else {
+                freeTail = *link;
+                link = &(*link)->next;
+            }
+        }
+
+        // pending ranges of dropped blocks go with them
+        pending.erase(std::remove_if(pending.begin(), pending.end(),
+                                     [&](const std::pair<Slot*, Slot*>& range) { return drop[blockOf(range.first)]; }),
+                      pending.end());
+
+        bool bumpDropped = bumpCur != bumpEnd && drop[blockOf(bumpCur)];
+        std::vector<Slot*> kept;
+        kept.reserve(blocks.size());
+        for (std::size_t i = 0; i < blocks.size(); i++) {
+            if (drop[i]) {
+                Backend::deallocate(blocks[i], BlockSize * sizeof(Slot));
+            } else {
+                kept.push_back(blocks[i]);
+            }
+        }
+        blocks.swap(kept);
+
+        // every untouched block was empty, so all kept blocks are carved
+        nextBlock = blocks.size();
+        if (bumpDropped) bumpCur = bumpEnd = nullptr;
+    }
+
+    // forget every object at once but keep the blocks for reuse: O(1), no destructor runs,
+    // so only use it when T is trivially destructible (or every object was already destroyed)
+    void reset() {
+        pending.clear();
+        freeList = freeTail = nullptr;
+        bumpCur = bumpEnd = nullptr;
+        nextBlock = 0;
+        liveCount = 0;
+    }
+
+    // free every block; all objects must already be deallocated (or be abandoned on purpose)
+    void release() {
+        for (Slot* block : blocks) {
+            Backend::deallocate(block, BlockSize * sizeof(Slot));
+        }
+        blocks.clear();
+        pending.clear();
+        freeList = freeTail = nullptr;
+        bumpCur = bumpEnd = nullptr;
+        nextBlock = 0;
+        liveCount = 0;
+    }
+
+    static constexpr std::size_t blockSize() { return BlockSize; }
+
+    // backend counters (e.g. HugePageBackend::hugeTlbBytes())
+    const Backend &backend() const { return *this; }
+
+    std::size_t live() const { return liveCount; }
+    std::size_t peak() const { return peakCount; }
+    std::size_t blockCount() const { return blocks.size(); }
+    std::size_t bytesReserved() const { return blocks.size() * BlockSize * sizeof(Slot); }
+
+    PoolStats stats() const {
+        return PoolStats{liveCount, peakCount, blocks.size(), bytesReserved()};
+    }
 };
 
-#endif
\ No newline at end of file
+#endif
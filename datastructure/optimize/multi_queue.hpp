@@ -0,0 +1,107 @@
+#ifndef MULTI_QUEUE_HPP
+#define MULTI_QUEUE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "pairing_heap.hpp"
+
+namespace Opt {
+    // relaxed concurrent min-priority-queue (MultiQueue, Rihani/Sanders/Dementiev):
+    // c * p independent PairingHeap shards, each behind a try-lock.
+    //   insert    -> a random shard whose lock is free
+    //   deleteMin -> the smaller top of two random shards (not the exact global min)
+    // Each shard's PairingHeap / MemoryPool is only touched while its lock is held.
+    template<typename T, typename Pairing = TwoPass>
+    class MultiQueue {
+    private:
+        // shard element: key + generation stamp (unique per shard, never 0 while queued).
+        // Moving an entry out (deleteMin) zeroes the source stamp, and the stamp sits past the
+        // pool's free-list link (Node::key starts the slot), so a popped node keeps 0 until its
+        // slot is reused by an insert with a new stamp -> a stale Handle never matches.
+        struct Entry {
+            T key;
+            std::uint64_t gen;
+
+            Entry(T k, std::uint64_t g) : key(std::move(k)), gen(g) {}
+            Entry(const Entry&) = default;
+            Entry& operator=(const Entry&) = default;
+            Entry(Entry&& other) : key(std::move(other.key)), gen(other.gen) { other.gen = 0; }
+            Entry& operator=(Entry&& other) {
+                key = std::move(other.key);
+                gen = other.gen;
+                other.gen = 0;
+                return *this;
+            }
+
+            bool operator>(const Entry& other) const { return key > other.key; }
+        };
+
+    public:
+        // node handle + owning shard + generation, so tryDecreaseKey works from any thread and
+        // can tell a live node from a popped (or popped and reused) one
+        struct Handle {
+            std::uint32_t shard;
+            Node<Entry> *node;
+            std::uint64_t gen;
+        };
+
+    private:
+        // one cache line per shard lock to avoid false sharing between shards
+        struct alignas(64) Shard {
+            std::atomic_flag flag = ATOMIC_FLAG_INIT;
+            PairingHeap<Entry, Pairing> heap;
+            std::uint64_t nextGen = 0;
+
+            bool tryLock() { return !flag.test_and_set(std::memory_order_acquire); }
+            void lock() {
+                for (int spins = 0; !tryLock(); spins++) {
+                    if (spins >= 64) std::this_thread::yield();
+                }
+            }
+            void unlock() { flag.clear(std::memory_order_release); }
+        };
+
+        std::vector<std::unique_ptr<Shard>> shards;
+        std::atomic<std::size_t> count;
+
+        // per-thread xorshift64* (no shared RNG state)
+        static std::uint64_t nextRandom();
+        std::uint32_t randomShard() const;
+
+    public:
+        // threads: expected number of concurrent users p, c: shards per thread (c * p shards)
+        explicit MultiQueue(int threads, int c = 2);
+
+        MultiQueue(const MultiQueue&) = delete;
+        MultiQueue& operator=(const MultiQueue&) = delete;
+
+        // approximate under concurrent updates
+        bool empty() const { return count.load(std::memory_order_relaxed) == 0; }
+        std::size_t size() const { return count.load(std::memory_order_relaxed); }
+        std::size_t shardCount() const { return shards.size(); }
+
+        // insert: return handle for tryDecreaseKey
+        Handle insert(T key);
+
+        // decrease-key: newKey must be <= current key (blocks on the owning shard's lock).
+        // false (nothing changed) when the item already left the queue, e.g. another thread's
+        // tryDeleteMin popped it, even if its node slot was reused since
+        bool tryDecreaseKey(Handle handle, T newKey);
+
+        // delete-min (relaxed): false when the queue looked empty
+        bool tryDeleteMin(T &out);
+    };
+
+    #include "multi_queue.ipp"
+}
+
+#endif
@@ -0,0 +1,123 @@
+#ifdef __INTELLISENSE__
+#include "multi_queue.hpp"
+#endif
+
+using namespace Opt;
+
+template <typename T, typename Pairing>
+MultiQueue<T, Pairing>::MultiQueue(int threads, int c) : count(0) {
+    if (threads < 1 || c < 1) throw std::invalid_argument("MultiQueue: threads and c must be >= 1");
+
+    // at least two shards so deleteMin always has two candidates
+    std::size_t n = std::max<std::size_t>(2, (std::size_t)threads * c);
+    shards.reserve(n);
+    for (std::size_t i = 0; i < n; i++) shards.emplace_back(new Shard());
+}
+
+template <typename T, typename Pairing>
+std::uint64_t MultiQueue<T, Pairing>::nextRandom() {
+    thread_local std::uint64_t state =
+        std::hash<std::thread::id>()(std::this_thread::get_id()) * 0x9E3779B97F4A7C15ULL | 1;
+
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return state * 0x2545F4914F6CDD1DULL;
+}
+
+template <typename T, typename Pairing>
+std::uint32_t MultiQueue<T, Pairing>::randomShard() const {
+    return (std::uint32_t)((nextRandom() >> 32) % shards.size());
+}
+
+template <typename T, typename Pairing>
+typename MultiQueue<T, Pairing>::Handle MultiQueue<T, Pairing>::insert(T key) {
+    while (true) {
+        std::uint32_t i = randomShard();
+        Shard &s = *shards[i];
+        if (!s.tryLock()) continue;
+
+        std::uint64_t gen = ++s.nextGen;
+        Node<Entry> *node = s.heap.insert(Entry(std::move(key), gen));
+        // counted before the node becomes poppable, so the matching fetch_sub can never run
+        // first and wrap count around
+        count.fetch_add(1, std::memory_order_relaxed);
+        s.unlock();
+
+        return Handle{i, node, gen};
+    }
+}
+
+template <typename T, typename Pairing>
+bool MultiQueue<T, Pairing>::tryDecreaseKey(Handle handle, T newKey) {
+    Shard &s = *shards[handle.shard];
+    s.lock();
+
+    // popped: stamp zeroed on move-out; reused: stamp of the new entry
+    if (handle.node->key.gen != handle.gen) {
+        s.unlock();
+        return false;
+    }
+
+    try {
+        s.heap.decreaseKey(handle.node, Entry(std::move(newKey), handle.gen));
+    } catch (...) {
+        s.unlock();
+        throw;
+    }
+    s.unlock();
+    return true;
+}
+
+template <typename T, typename Pairing>
+bool MultiQueue<T, Pairing>::tryDeleteMin(T &out) {
+    int misses = 0;
+
+    while (count.load(std::memory_order_relaxed) > 0) {
+        std::uint32_t i = randomShard();
+        std::uint32_t j = randomShard();
+
+        Shard &a = *shards[i];
+        if (!a.tryLock()) continue;
+
+        Shard *best = a.heap.empty() ? nullptr : &a;
+        Shard *other = nullptr;
+
+        if (j != i && shards[j]->tryLock()) {
+            other = shards[j].get();
+            // smaller top of the two (heap keys compare with operator>)
+            if (!other->heap.empty() && (!best || best->heap.getMin() > other->heap.getMin())) {
+                best = other;
+            }
+        }
+
+        bool found = (best != nullptr);
+        if (found) out = std::move(best->heap.deleteMin().key);
+
+        if (other) other->unlock();
+        a.unlock();
+
+        if (found) {
+            count.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        // both picks empty: after a few misses sweep every shard so a nearly empty queue still drains
+        if (++misses >= 8) {
+            for (auto &sp : shards) {
+                Shard &s = *sp;
+                s.lock();
+                if (!s.heap.empty()) {
+                    out = std::move(s.heap.deleteMin().key);
+                    s.unlock();
+                    count.fetch_sub(1, std::memory_order_relaxed);
+                    return true;
+                }
+                s.unlock();
+            }
+            misses = 0;
+        }
+    }
+
+    return false;
+}
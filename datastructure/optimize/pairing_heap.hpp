@@ -5,8 +5,13 @@
 #include <cstddef>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <utility>
 
 #include "memory_pool.hpp"
+#include "pairing_policy.hpp"
+#include "pairing_stats.hpp"
+#include "prefetch_policy.hpp"
 
 namespace Opt {
     template<typename T>
@@ -16,44 +21,89 @@ namespace Opt {
         Node<T> *sibling;
         Node<T> *prev;
 
-        explicit Node(T k)
-            : key(k), child(nullptr), sibling(nullptr), prev(nullptr) {}
+        // key is built in place from args (copy, move or T's own constructor arguments)
+        template <typename... Args>
+        explicit Node(std::in_place_t, Args&&... args)
+            : key(std::forward<Args>(args)...), child(nullptr), sibling(nullptr), prev(nullptr) {}
     };
 
-    template<typename T>
-    class PairingHeap {
+    // Pairing: TwoPass (default), MultiPass, FrontToBack or AuxTwoPass (see pairing_policy.hpp)
+    // Stats: NoStats (default, compiled out) or CountingStats (see pairing_stats.hpp);
+    // inherited so that NoStats takes no space
+    // Locality: NoPrefetch (default), Prefetch, FreshNodes, PrefetchFresh, HugePages or NumaHugePages
+    // (see prefetch_policy.hpp)
+    template<typename T, typename Pairing = TwoPass, typename Stats = NoStats, typename Locality = NoPrefetch>
+    class PairingHeap : private Stats {
     private:
         Node<T> *root;
         std::size_t sz;
 
-        MemoryPool<Node<T>> pool;
+        MemoryPool<Node<T>, Locality::poolBlockSize, typename Locality::PoolOrder, typename Locality::PoolBackend> pool;
 
         // meld two heaps rooted at a and b, return new root
-        static Node<T> *merge(Node<T> *a, Node<T> *b);
+        Node<T> *merge(Node<T> *a, Node<T> *b);
+
+        // delete-min helper: combine sibling list with the Pairing policy (iterative)
+        Node<T> *twoPassMerge(Node<T> *firstSibling);
 
-        // delete-min helper: two-pass pairing merge on sibling list
-        static Node<T> *twoPassMerge(Node<T> *firstSibling);
+        // auxiliary-root-list helper: multipass merge on sibling list
+        Node<T> *multiPassMerge(Node<T> *firstSibling);
+
+        static std::size_t listLength(const Node<T> *x) {
+            std::size_t n = 0;
+            for (; x; x = x->sibling) n++;
+            return n;
+        }
+
+        // auxiliary-root-list helper: add standalone root x to the list hanging off root->sibling
+        void pushRoot(Node<T> *x);
 
         // decrease-key helper: cut x from its current position (x becomes a standalone root)
         static void cut(Node<T> *x);
 
-        // destructor/clear helper: delete all nodes in subtree
+        // destructor/clear helper: delete all nodes in subtree (iterative)
         void deleteAll(Node<T>* x);
     public:
         PairingHeap() : root(nullptr), sz(0) {}
-        ~PairingHeap() { clear(); }
+
+        // bulk build from [first, last) (see insertBatch)
+        template <typename InputIt>
+        PairingHeap(InputIt first, InputIt last) : root(nullptr), sz(0) { insertBatch(first, last); }
+        ~PairingHeap() { reset(); }
 
         bool empty() const { return root == nullptr; }
         std::size_t size() const { return sz; }
 
-        // get-min
-        T getMin() const {
+        // node pool counters (live / peak nodes, blocks, bytes reserved)
+        PoolStats poolStats() const { return pool.stats(); }
+
+        // structural counters (only meaningful with Stats = CountingStats)
+        const Stats &stats() const { return *this; }
+        Stats &stats() { return *this; }
+
+        // get-min: reference to the root key, valid until the next modifying call
+        const T &getMin() const {
             if(!root) throw std::runtime_error("PairingHeap::getMin(): empty heap");
             return root->key;
         }
 
         // insert: return handle for decreaseKey
-        Node<T> *insert(T key);
+        Node<T> *insert(const T &key) { return emplace(key); }
+        Node<T> *insert(T &&key) { return emplace(std::move(key)); }
+
+        // emplace: construct the key directly in the pool slot from T's constructor arguments
+        template <typename... Args>
+        Node<T> *emplace(Args&&... args);
+
+        // batched insert: nodes are carved back to back from the pool and linked into one
+        // tree by a binary-counter build (equal-size trees linked pairwise, n - 1 links, linear
+        // time), then melded with the current root;
+        // the handles (same order as the input) are written to `handles`
+        template <typename InputIt, typename OutputIt>
+        OutputIt insertBatch(InputIt first, InputIt last, OutputIt handles);
+
+        template <typename InputIt>
+        void insertBatch(InputIt first, InputIt last);
 
         // meld: consume other (other becomes empty)
         void meld(PairingHeap& other);
@@ -61,7 +111,7 @@ namespace Opt {
         // decrease-key: newKey must be <= node->key
         void decreaseKey(Node<T> *node, T newKey);
 
-        // delete-min: remove root and return min value
+        // delete-min: remove root and return min value (moved out of the node)
         T deleteMin();
 
         // free all nodes
@@ -70,6 +120,18 @@ namespace Opt {
             root = nullptr;
             sz = 0;
         }
+
+        // drop all nodes at once: rewinds the pool in O(1) when T is trivially destructible,
+        // otherwise same as clear(); all handles become invalid either way
+        void reset() {
+            if constexpr (std::is_trivially_destructible<T>::value) {
+                pool.reset();
+                root = nullptr;
+                sz = 0;
+            } else {
+                clear();
+            }
+        }
     };
 
     #include "pairing_heap.ipp"
@@ -4,11 +4,13 @@
 
 using namespace Opt;
 
-template <typename T>
-Node<T> *PairingHeap<T>::merge(Node<T> *a, Node<T> *b) {
+template <typename T, typename Pairing, typename Stats, typename Locality>
+Node<T> *PairingHeap<T, Pairing, Stats, Locality>::merge(Node<T> *a, Node<T> *b) {
     if(!a) return b;
     if(!b) return a;
 
+    Stats::onLink();
+
     if(a->key > b->key) {
         Node<T> *tmp = a;
         a = b; b = tmp;
@@ -22,55 +24,159 @@ Node<T> *PairingHeap<T>::merge(Node<T> *a, Node<T> *b) {
     return a;
 }
 
-template <typename T>
-Node<T> *PairingHeap<T>::insert(T key) {
+template <typename T, typename Pairing, typename Stats, typename Locality>
+template <typename... Args>
+Node<T> *PairingHeap<T, Pairing, Stats, Locality>::emplace(Args&&... args) {
     // Node<T> *node = new Node<T>(key); (origin)
-    Node<T> *node = pool.allocate(key); // use memory pool
+    Node<T> *node = pool.allocate(std::in_place, std::forward<Args>(args)...); // use memory pool
+    Stats::onInsert();
 
-    root = merge(root, node);
+    if constexpr (Pairing::auxiliary) {
+        pushRoot(node);
+    } else {
+        root = merge(root, node);
+    }
     sz++;
     return node;
 }
 
-template <typename T>
-void PairingHeap<T>::meld(PairingHeap<T>& other) {
+template <typename T, typename Pairing, typename Stats, typename Locality>
+template <typename InputIt, typename OutputIt>
+OutputIt PairingHeap<T, Pairing, Stats, Locality>::insertBatch(InputIt first, InputIt last, OutputIt handles) {
+    // binary-counter build: stack[k] holds a binomial-shaped tree of 2^rank[k] nodes, two trees
+    // of equal rank are linked as soon as they meet (like carries in a binary increment); at the
+    // end the leftover trees (one per set bit of n) are linked smallest first -> n - 1 links in
+    // total, and every link touches nodes carved a moment ago, so the build stays in cache
+    Node<T> *stack[64];
+    unsigned char rank[64];
+    int top = 0;
+    std::size_t n = 0;
+
+    for (; first != last; ++first) {
+        Node<T> *tree = pool.allocateFresh(std::in_place, *first);
+        *handles++ = tree;
+        n++;
+        Stats::onInsert();
+
+        unsigned char r = 0;
+        while (top > 0 && rank[top - 1] == r) {
+            tree = merge(stack[--top], tree);
+            r++;
+        }
+        stack[top] = tree;
+        rank[top++] = r;
+    }
+
+    if (top == 0) return handles;
+
+    Node<T> *tree = stack[--top];
+    while (top > 0) {
+        tree = merge(stack[--top], tree);
+    }
+    tree->prev = nullptr;
+
+    if constexpr (Pairing::auxiliary) {
+        pushRoot(tree);
+    } else {
+        root = merge(root, tree);
+    }
+    sz += n;
+    return handles;
+}
+
+template <typename T, typename Pairing, typename Stats, typename Locality>
+template <typename InputIt>
+void PairingHeap<T, Pairing, Stats, Locality>::insertBatch(InputIt first, InputIt last) {
+    struct Discard {
+        Discard &operator*() { return *this; }
+        Discard &operator++(int) { return *this; }
+        Discard &operator=(Node<T> *) { return *this; }
+    };
+    insertBatch(first, last, Discard());
+}
+
+template <typename T, typename Pairing, typename Stats, typename Locality>
+void PairingHeap<T, Pairing, Stats, Locality>::meld(PairingHeap<T, Pairing, Stats, Locality>& other) {
     if (other.empty()) return;
 
-    root = merge(root, other.root);
+    if constexpr (Pairing::auxiliary) {
+        // collapse other's root list into one tree, then append it to ours
+        Node<T> *tree = other.root;
+        Node<T> *rest = tree->sibling;
+        tree->sibling = nullptr;
+        if (rest) rest->prev = nullptr;
+        tree = merge(tree, multiPassMerge(rest));
+        tree->prev = nullptr;
+        pushRoot(tree);
+    } else {
+        root = merge(root, other.root);
+    }
     sz += other.sz;
 
+    // other's nodes now belong to this tree, so this pool takes over their blocks
+    pool.absorb(other.pool);
+
     other.root = nullptr;
     other.sz = 0;
 }
 
-template <typename T>
-Node<T> *PairingHeap<T>::twoPassMerge(Node<T> *firstSibling) {
-    if(!firstSibling) return nullptr;
-    if(!firstSibling->sibling) return firstSibling;
+template <typename T, typename Pairing, typename Stats, typename Locality>
+Node<T> *PairingHeap<T, Pairing, Stats, Locality>::twoPassMerge(Node<T> *firstSibling) {
+    if constexpr (Stats::enabled) {
+        if (firstSibling) Stats::onCombine(listLength(firstSibling));
+    }
+    return Pairing::template combine<Locality>(firstSibling, [this](Node<T> *a, Node<T> *b) { return merge(a, b); });
+}
 
-    Node<T> *a = firstSibling;
-    Node<T> *b = firstSibling->sibling;
-    Node<T> *remaining = b->sibling;
+template <typename T, typename Pairing, typename Stats, typename Locality>
+Node<T> *PairingHeap<T, Pairing, Stats, Locality>::multiPassMerge(Node<T> *firstSibling) {
+    if constexpr (Stats::enabled) {
+        if (firstSibling) Stats::onCombine(listLength(firstSibling));
+    }
+    return MultiPass::template combine<Locality>(firstSibling, [this](Node<T> *a, Node<T> *b) { return merge(a, b); });
+}
 
-    a->sibling = nullptr;
-    b->sibling = nullptr;
+template <typename T, typename Pairing, typename Stats, typename Locality>
+void PairingHeap<T, Pairing, Stats, Locality>::pushRoot(Node<T> *x) {
+    if (!root) {
+        root = x;
+        return;
+    }
 
-    return merge(merge(a, b), twoPassMerge(remaining));
+    if (root->key > x->key) {
+        // x becomes the new min, old root moves to the front of the root list
+        x->sibling = root;
+        root->prev = x;
+        root = x;
+        return;
+    }
+
+    x->prev = root;
+    x->sibling = root->sibling;
+    if (root->sibling) root->sibling->prev = x;
+    root->sibling = x;
 }
 
-template <typename T>
-T PairingHeap<T>::deleteMin() {
+template <typename T, typename Pairing, typename Stats, typename Locality>
+T PairingHeap<T, Pairing, Stats, Locality>::deleteMin() {
     if(this->empty()) throw std::runtime_error("PairingHeap::deleteMin(): empty heap");
 
     Node<T> *oldRoot = root;
-    T result = root->key;
+    T result = std::move(root->key); // root node is freed below, nothing reads its key again
     Node<T> *children = root->child;
 
     if (children) {
         children->prev = nullptr;
     }
 
-    root = twoPassMerge(children);
+    if constexpr (Pairing::auxiliary) {
+        Node<T> *aux = root->sibling;
+        if (aux) aux->prev = nullptr;
+
+        root = merge(multiPassMerge(aux), twoPassMerge(children));
+    } else {
+        root = twoPassMerge(children);
+    }
     
     // delete oldRoot; (origin)
     pool.deallocate(oldRoot); // use memory pool
@@ -80,11 +186,14 @@ T PairingHeap<T>::deleteMin() {
         root->prev = nullptr;
     }
 
+    Stats::onDeleteMin();
+    Stats::onTree(root);
+
     return result;
 }
 
-template <typename T>
-void PairingHeap<T>::cut(Node<T> *x) {
+template <typename T, typename Pairing, typename Stats, typename Locality>
+void PairingHeap<T, Pairing, Stats, Locality>::cut(Node<T> *x) {
     Node<T> *previous = x->prev;
     Node<T> *nextSibling = x->sibling;
 
@@ -102,32 +211,45 @@ void PairingHeap<T>::cut(Node<T> *x) {
     x->sibling = nullptr;
 }
 
-template <typename T>
-void PairingHeap<T>::decreaseKey(Node<T> *node, T newKey) {
+template <typename T, typename Pairing, typename Stats, typename Locality>
+void PairingHeap<T, Pairing, Stats, Locality>::decreaseKey(Node<T> *node, T newKey) {
     if (newKey > node->key) throw std::runtime_error("PairingHeap::decreaseKey: newKey must be <= current key");
 
-    node->key = newKey;
+    // cut() rewrites both neighbours of node: start fetching them before the key store
+    Locality::write(node->prev);
+    Locality::write(node->sibling);
+
+    node->key = std::move(newKey);
 
+    Stats::onDecreaseKey(node != root);
     if (node == root) return;
 
     cut(node);
 
-    root = merge(root, node);
+    if constexpr (Pairing::auxiliary) {
+        pushRoot(node);
+    } else {
+        root = merge(root, node);
+    }
 }
 
-template <typename T>
-void PairingHeap<T>::deleteAll(Node<T> *x) {
-    if (!x) return;
-    
-    Node<T> *current = x;
-
-    while (current) {
-        Node<T> *next = current->sibling;
-        deleteAll(current->child);
-
-        // delete current; (origin)
-        pool.deallocate(current); // use memory pool
-
-        current = next;  
+template <typename T, typename Pairing, typename Stats, typename Locality>
+void PairingHeap<T, Pairing, Stats, Locality>::deleteAll(Node<T> *x) {
+    // child/sibling links form a binary tree: rotate each child up into the sibling chain
+    // until the current node has no child, then free it -> O(n), no recursion, no stack
+    while (x) {
+        if (x->child) {
+            Node<T> *c = x->child;
+            x->child = c->sibling;
+            c->sibling = x;
+            x = c;
+        } else {
+            Node<T> *next = x->sibling;
+
+            // delete x; (origin)
+            pool.deallocate(x); // use memory pool
+
+            x = next;
+        }
     }
 }
@@ -0,0 +1,167 @@
+#ifndef PAIRING_POLICY_HPP
+#define PAIRING_POLICY_HPP
+
+// Pairing strategies for PairingHeap<T, Pairing>::deleteMin (and the index-linked KeyedPairingHeap).
+// combine(first, link) folds a sibling list into a single tree without recursion;
+// `link(a, b)` melds two standalone roots (sibling == nil) and returns the new root.
+// combine<Hints>(first, link): same, Hints::read / write (see prefetch_policy.hpp) are called on
+// the next node of the list and on the child lists the next link writes into.
+// combine<Hints>(first, links, link): same on any node reference (pointer or array index);
+// `links` says how to follow it: nil(), sibling(x) (assignable), child(x), addr(x) (for Hints).
+// combine(first, link) on NodeT* is combine(first, PointerLinks<NodeT>(), link).
+
+#include "prefetch_policy.hpp"
+
+namespace Opt {
+    // links of pointer-linked nodes (NodeT::sibling / NodeT::child are NodeT*)
+    template <typename NodeT>
+    struct PointerLinks {
+        static NodeT *nil() { return nullptr; }
+        static NodeT *&sibling(NodeT *x) { return x->sibling; }
+        static NodeT *child(NodeT *x) { return x->child; }
+        static const NodeT *addr(NodeT *x) { return x; }
+    };
+
+    // standard two-pass: pair left -> right, then fold the pairs right -> left
+    struct TwoPass {
+        static constexpr bool auxiliary = false;
+
+        template <typename Hints = NoPrefetch, typename NodeT, typename Link>
+        static NodeT *combine(NodeT *first, Link link) {
+            return combine<Hints>(first, PointerLinks<NodeT>(), link);
+        }
+
+        template <typename Hints = NoPrefetch, typename Ref, typename Links, typename Link>
+        static Ref combine(Ref first, Links links, Link link) {
+            if (first == links.nil()) return first;
+            if (links.sibling(first) == links.nil()) return first;
+
+            // pass 1: merged pairs are pushed onto a stack threaded through `sibling`
+            Ref pairs = links.nil();
+            Ref current = first;
+
+            while (current != links.nil()) {
+                Ref a = current;
+                Ref b = links.sibling(a);
+
+                if (b == links.nil()) {
+                    links.sibling(a) = pairs;
+                    pairs = a;
+                    break;
+                }
+
+                current = links.sibling(b);
+                links.sibling(a) = links.nil();
+                links.sibling(b) = links.nil();
+
+                // the loser's child list gets a new head: fetch it (and the next pair) during this link
+                Hints::read(links.addr(current));
+                Hints::write(links.addr(links.child(a)));
+                Hints::write(links.addr(links.child(b)));
+
+                Ref m = link(a, b);
+                links.sibling(m) = pairs;
+                pairs = m;
+            }
+
+            // pass 2: pop the stack (= right -> left) into one tree
+            Ref result = pairs;
+            pairs = links.sibling(pairs);
+            links.sibling(result) = links.nil();
+
+            while (pairs != links.nil()) {
+                Ref next = links.sibling(pairs);
+                links.sibling(pairs) = links.nil();
+                Hints::read(links.addr(next));
+                Hints::write(links.addr(links.child(pairs)));
+                result = link(pairs, result);
+                pairs = next;
+            }
+
+            return result;
+        }
+    };
+
+    // multipass / FIFO: link the first two trees, append the result to the back, repeat
+    struct MultiPass {
+        static constexpr bool auxiliary = false;
+
+        template <typename Hints = NoPrefetch, typename NodeT, typename Link>
+        static NodeT *combine(NodeT *first, Link link) {
+            return combine<Hints>(first, PointerLinks<NodeT>(), link);
+        }
+
+        template <typename Hints = NoPrefetch, typename Ref, typename Links, typename Link>
+        static Ref combine(Ref first, Links links, Link link) {
+            if (first == links.nil()) return first;
+            if (links.sibling(first) == links.nil()) return first;
+
+            Ref head = first;
+            Ref tail = first;
+            while (links.sibling(tail) != links.nil()) tail = links.sibling(tail);
+
+            while (head != tail) {
+                Ref a = head;
+                Ref b = links.sibling(a);
+                head = links.sibling(b);
+
+                links.sibling(a) = links.nil();
+                links.sibling(b) = links.nil();
+
+                Hints::read(links.addr(head));
+                Hints::write(links.addr(links.child(a)));
+                Hints::write(links.addr(links.child(b)));
+
+                Ref m = link(a, b);
+
+                if (head == links.nil()) {
+                    head = tail = m;
+                } else {
+                    links.sibling(tail) = m;
+                    tail = m;
+                }
+            }
+
+            return head;
+        }
+    };
+
+    // front-to-back: accumulate a single tree left -> right
+    struct FrontToBack {
+        static constexpr bool auxiliary = false;
+
+        template <typename Hints = NoPrefetch, typename NodeT, typename Link>
+        static NodeT *combine(NodeT *first, Link link) {
+            return combine<Hints>(first, PointerLinks<NodeT>(), link);
+        }
+
+        template <typename Hints = NoPrefetch, typename Ref, typename Links, typename Link>
+        static Ref combine(Ref first, Links links, Link link) {
+            if (first == links.nil()) return first;
+
+            Ref result = first;
+            Ref current = links.sibling(first);
+            links.sibling(result) = links.nil();
+
+            while (current != links.nil()) {
+                Ref next = links.sibling(current);
+                links.sibling(current) = links.nil();
+                Hints::read(links.addr(next));
+                Hints::write(links.addr(links.child(current)));
+                result = link(result, current);
+                current = next;
+            }
+
+            return result;
+        }
+    };
+
+    // auxiliary two-pass (Stasko & Vitter): insert/decreaseKey only append to a root list
+    // (root->sibling chain) without linking; deleteMin multipass-combines that list and
+    // two-pass-combines the children of the old root.
+    struct AuxTwoPass : TwoPass {
+        static constexpr bool auxiliary = true;
+    };
+}
+
+#endif
@@ -0,0 +1,106 @@
+#ifndef PAIRING_STATS_HPP
+#define PAIRING_STATS_HPP
+
+// Structural statistics for PairingHeap<T, Pairing, Stats>.
+// The heap calls the hooks below; NoStats (default) has empty inline hooks and no data, so the
+// counters compile away. CountingStats keeps PairingCounters:
+//   links       - merge() calls that linked two trees (insert, decreaseKey, pairing, meld)
+//   combines    - sibling lists handed to the pairing pass (deleteMin, aux root list), their
+//                 lengths summed / maxed / in a log2 histogram
+//   cuts        - decreaseKey calls that cut a subtree (the rest hit the root)
+//   depth       - every `sampleEvery`-th deleteMin walks the whole tree and adds each node's
+//                 depth (root = 0, siblings share a depth) to a log2 histogram
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <utility>
+
+namespace Opt {
+    struct PairingCounters {
+        static const int BUCKETS = 40; // bucket b: values in [2^b - 1, 2^(b+1) - 1)
+
+        std::uint64_t inserts = 0;
+        std::uint64_t deleteMins = 0;
+        std::uint64_t decreaseKeys = 0;
+        std::uint64_t cuts = 0;
+        std::uint64_t links = 0;
+
+        std::uint64_t combines = 0;
+        std::uint64_t combinedRoots = 0;  // sum of list lengths
+        std::uint64_t maxCombine = 0;
+        std::uint64_t combineHist[BUCKETS] = {};
+
+        std::uint64_t depthSamples = 0;   // tree walks
+        std::uint64_t nodesSampled = 0;   // nodes seen over all walks
+        std::uint64_t depthSum = 0;
+        std::uint64_t maxDepth = 0;
+        std::uint64_t depthHist[BUCKETS] = {};
+
+        static int bucketOf(std::uint64_t x) {
+            int b = 0;
+            for (x += 1; x > 1 && b < BUCKETS - 1; x >>= 1) b++;
+            return b;
+        }
+
+        double avgCombine() const { return combines ? (double)combinedRoots / combines : 0.0; }
+        double avgDepth() const { return nodesSampled ? (double)depthSum / nodesSampled : 0.0; }
+    };
+
+    struct NoStats {
+        static constexpr bool enabled = false;
+
+        void onInsert() {}
+        void onDeleteMin() {}
+        void onDecreaseKey(bool) {}
+        void onLink() {}
+        void onCombine(std::size_t) {}
+        template <typename NodeT>
+        void onTree(const NodeT *) {}
+    };
+
+    struct CountingStats {
+        static constexpr bool enabled = true;
+
+        PairingCounters counters;
+        std::uint64_t sampleEvery = 256; // depth walk every n-th deleteMin (0 = never)
+
+        void onInsert() { counters.inserts++; }
+        void onDeleteMin() { counters.deleteMins++; }
+        void onDecreaseKey(bool cut) {
+            counters.decreaseKeys++;
+            if (cut) counters.cuts++;
+        }
+        void onLink() { counters.links++; }
+        void onCombine(std::size_t len) {
+            counters.combines++;
+            counters.combinedRoots += len;
+            if (len > counters.maxCombine) counters.maxCombine = len;
+            counters.combineHist[PairingCounters::bucketOf(len)]++;
+        }
+
+        // called with the root after a deleteMin; walks the tree when a sample is due
+        template <typename NodeT>
+        void onTree(const NodeT *root) {
+            if (!root || sampleEvery == 0 || counters.deleteMins % sampleEvery != 0) return;
+            counters.depthSamples++;
+
+            // explicit stack of (first node of a sibling list, depth)
+            std::vector<std::pair<const NodeT*, std::uint64_t>> stack;
+            stack.push_back({root, 0});
+            while (!stack.empty()) {
+                std::pair<const NodeT*, std::uint64_t> top = stack.back();
+                stack.pop_back();
+                for (const NodeT *x = top.first; x; x = x->sibling) {
+                    counters.nodesSampled++;
+                    counters.depthSum += top.second;
+                    if (top.second > counters.maxDepth) counters.maxDepth = top.second;
+                    counters.depthHist[PairingCounters::bucketOf(top.second)]++;
+                    if (x->child) stack.push_back({x->child, top.second + 1});
+                }
+            }
+        }
+    };
+}
+
+#endif
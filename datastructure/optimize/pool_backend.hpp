@@ -0,0 +1,198 @@
+#ifndef POOL_BACKEND_HPP
+#define POOL_BACKEND_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Where MemoryPool<T, BlockSize, Order, Backend> gets its blocks from. A pool always asks for
+// the same block size; the backend is a (private) base of the pool, one instance per pool.
+//   void *allocate(bytes) / void deallocate(p, bytes)
+//   void absorb(other): take over what other still owns (MemoryPool::absorb moved its blocks)
+
+// default: every block is its own ::operator new
+struct NewBackend {
+    static void *allocate(std::size_t bytes) { return ::operator new(bytes); }
+    static void deallocate(void *p, std::size_t) { ::operator delete(p); }
+    static void absorb(NewBackend &) {}
+};
+
+#if defined(__linux__)
+
+// blocks carved from large anonymous mmap regions (2 MiB aligned, growing x2 up to 1 GiB):
+//   - MAP_HUGETLB first (needs a preallocated hugetlbfs pool, vm.nr_hugepages);
+//   - otherwise normal pages + madvise(MADV_HUGEPAGE), so transparent huge pages can back them
+//     (THP "madvise" or "always" mode; with THP "never" this is plain 4 KiB pages);
+//   - LocalNode = true: mbind(MPOL_BIND) each region to the NUMA node of the calling CPU
+//     before it is touched (ignored where mbind is not available).
+// Freed blocks are kept for reuse; the regions are unmapped when the last block comes back
+// (MemoryPool::release / destructor), so shrink_to_fit does not return memory to the OS here.
+template <bool LocalNode = false>
+class HugePageBackend {
+    static constexpr std::size_t HUGE_PAGE = std::size_t(2) << 20;
+    static constexpr std::size_t MAX_REGION = std::size_t(1) << 30;
+
+    struct Region {
+        char *base;
+        std::size_t bytes;
+    };
+
+    std::vector<Region> regions;
+    std::vector<void*> spare; // returned blocks, reused first
+
+    // carving range inside the newest region
+    char *cur = nullptr;
+    char *end = nullptr;
+
+    std::size_t liveBlocks = 0;
+    std::size_t nextRegion = HUGE_PAGE;
+    bool tryHugeTlb = true; // cleared after the first MAP_HUGETLB refusal
+
+    std::size_t hugeTlb = 0; // bytes mapped with MAP_HUGETLB
+    std::size_t advised = 0; // bytes madvise(MADV_HUGEPAGE) accepted
+    std::size_t bound = 0;   // bytes mbind accepted
+
+    static std::size_t roundUp(std::size_t n) { return (n + HUGE_PAGE - 1) / HUGE_PAGE * HUGE_PAGE; }
+
+    void bindToLocalNode(void *p, std::size_t len) {
+        unsigned cpu = 0, node = 0;
+        if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) return;
+
+        constexpr int MPOL_BIND_MODE = 2; // <numaif.h> MPOL_BIND, without linking libnuma
+        unsigned long mask[16] = {};
+        constexpr unsigned long BITS = 8 * sizeof(unsigned long);
+        if (node >= 16 * BITS) return;
+        mask[node / BITS] = 1UL << (node % BITS);
+
+        if (syscall(SYS_mbind, p, len, MPOL_BIND_MODE, mask, 16 * BITS, 0) == 0) bound += len;
+    }
+
+    void mapRegion(std::size_t len) {
+        void *p = MAP_FAILED;
+
+#ifdef MAP_HUGETLB
+        if (tryHugeTlb) {
+            p = mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (p != MAP_FAILED) hugeTlb += len;
+            else tryHugeTlb = false;
+        }
+#endif
+
+        if (p == MAP_FAILED) {
+            // over-map by one huge page, then trim both ends to a 2 MiB boundary
+            std::size_t raw = len + HUGE_PAGE;
+            void *r = mmap(nullptr, raw, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (r == MAP_FAILED) throw std::bad_alloc();
+
+            char *start = static_cast<char*>(r);
+            char *aligned = reinterpret_cast<char*>(
+                (reinterpret_cast<std::uintptr_t>(start) + HUGE_PAGE - 1) & ~(std::uintptr_t)(HUGE_PAGE - 1));
+            if (aligned > start) munmap(start, aligned - start);
+            std::size_t tail = (start + raw) - (aligned + len);
+            if (tail) munmap(aligned + len, tail);
+            p = aligned;
+
+#ifdef MADV_HUGEPAGE
+            if (madvise(p, len, MADV_HUGEPAGE) == 0) advised += len;
+#endif
+        }
+
+        if constexpr (LocalNode) bindToLocalNode(p, len);
+
+        regions.push_back(Region{static_cast<char*>(p), len});
+        cur = static_cast<char*>(p);
+        end = cur + len;
+    }
+
+    void unmapAll() {
+        for (const Region &r : regions) munmap(r.base, r.bytes);
+        regions.clear();
+        spare.clear();
+        cur = end = nullptr;
+        nextRegion = HUGE_PAGE;
+        hugeTlb = advised = bound = 0;
+    }
+
+public:
+    HugePageBackend() = default;
+    HugePageBackend(const HugePageBackend&) = delete;
+    HugePageBackend& operator=(const HugePageBackend&) = delete;
+
+    ~HugePageBackend() { unmapAll(); }
+
+    void *allocate(std::size_t bytes) {
+        liveBlocks++;
+        if (!spare.empty()) {
+            void *p = spare.back();
+            spare.pop_back();
+            return p;
+        }
+
+        if ((std::size_t)(end - cur) < bytes) {
+            std::size_t len = roundUp(bytes) > nextRegion ? roundUp(bytes) : nextRegion;
+            if (nextRegion < MAX_REGION) nextRegion *= 2;
+            mapRegion(len);
+        }
+        void *p = cur;
+        cur += bytes;
+        return p;
+    }
+
+    void deallocate(void *p, std::size_t) {
+        spare.push_back(p);
+        if (--liveBlocks == 0) unmapAll();
+    }
+
+    void absorb(HugePageBackend &other) {
+        if (this == &other) return;
+
+        // other's carving range is dropped (stays mapped until the regions go)
+        regions.insert(regions.end(), other.regions.begin(), other.regions.end());
+        spare.insert(spare.end(), other.spare.begin(), other.spare.end());
+        liveBlocks += other.liveBlocks;
+        hugeTlb += other.hugeTlb;
+        advised += other.advised;
+        bound += other.bound;
+
+        other.regions.clear();
+        other.spare.clear();
+        other.cur = other.end = nullptr;
+        other.liveBlocks = 0;
+        other.nextRegion = HUGE_PAGE;
+        other.hugeTlb = other.advised = other.bound = 0;
+    }
+
+    std::size_t mappedBytes() const {
+        std::size_t n = 0;
+        for (const Region &r : regions) n += r.bytes;
+        return n;
+    }
+    std::size_t hugeTlbBytes() const { return hugeTlb; }
+    std::size_t hugeAdvisedBytes() const { return advised; }
+    std::size_t numaBoundBytes() const { return bound; }
+};
+
+#else
+
+// no mmap / madvise: same blocks as NewBackend
+template <bool LocalNode = false>
+struct HugePageBackend : NewBackend {
+    std::size_t mappedBytes() const { return 0; }
+    std::size_t hugeTlbBytes() const { return 0; }
+    std::size_t hugeAdvisedBytes() const { return 0; }
+    std::size_t numaBoundBytes() const { return 0; }
+};
+
+#endif
+
+using NumaHugePageBackend = HugePageBackend<true>;
+
+#endif
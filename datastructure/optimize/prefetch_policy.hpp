@@ -0,0 +1,44 @@
+#ifndef PREFETCH_POLICY_HPP
+#define PREFETCH_POLICY_HPP
+
+#include "memory_pool.hpp"
+
+// Memory-locality policies for PairingHeap<T, Pairing, Stats, Locality>.
+//   read(p) / write(p): hint that *p is read / written soon (p may be nullptr, a prefetch never faults)
+//   PoolOrder: slot order of the node pool (ReuseFirst / FreshFirst, see memory_pool.hpp)
+//   PoolBackend: where the node pool gets its blocks (NewBackend / HugePageBackend, see pool_backend.hpp)
+//   poolBlockSize: nodes per pool block (4096; smaller for many tiny heaps, e.g. a meld workload)
+// Hints = true issues __builtin_prefetch one node ahead along the sibling list while pairing
+// and on the neighbours of a decreaseKey cut; Hints = false compiles every hook out.
+
+namespace Opt {
+    template <bool Hints, typename Order, typename Backend = NewBackend, std::size_t BlockSize = 4096>
+    struct Locality {
+        static constexpr bool enabled = Hints;
+        using PoolOrder = Order;
+        using PoolBackend = Backend;
+        static constexpr std::size_t poolBlockSize = BlockSize;
+
+        template <typename P>
+        static void read(const P *p) {
+            if constexpr (Hints) __builtin_prefetch(p, 0, 3);
+            else (void)p;
+        }
+
+        template <typename P>
+        static void write(const P *p) {
+            if constexpr (Hints) __builtin_prefetch(p, 1, 3);
+            else (void)p;
+        }
+    };
+
+    using NoPrefetch = Locality<false, ReuseFirst>;   // default
+    using Prefetch = Locality<true, ReuseFirst>;      // prefetch only
+    using FreshNodes = Locality<false, FreshFirst>;   // allocation order only
+    using PrefetchFresh = Locality<true, FreshFirst>; // both
+
+    using HugePages = Locality<false, ReuseFirst, HugePageBackend<>>;       // huge-page node blocks
+    using NumaHugePages = Locality<false, ReuseFirst, NumaHugePageBackend>; // + bound to the local NUMA node
+}
+
+#endif
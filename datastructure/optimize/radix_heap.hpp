@@ -0,0 +1,84 @@
+#ifndef RADIX_HEAP_HPP
+#define RADIX_HEAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace Opt {
+    // monotone min-priority-queue on 32-bit unsigned keys (radix heap):
+    // every inserted / decreased key must be >= the last deleted min.
+    // Bucket i > 0 holds keys whose highest bit differing from `last` is bit i-1,
+    // so each item moves down at most 32 times over its lifetime; no key comparisons between items.
+    template<typename T>
+    class RadixHeap {
+    public:
+        using Key = std::uint32_t;
+        using Handle = std::uint32_t;
+        static constexpr Handle NIL = 0xFFFFFFFFu;
+
+    private:
+        static const int BUCKETS = 33;
+
+        struct Item {
+            Key key;
+            T value;
+            std::uint32_t bucket;
+            std::uint32_t pos; // index inside buckets[bucket] (next free slot when freed)
+        };
+
+        std::vector<Item> items;
+        Handle freeHead;
+
+        // buckets[0] holds key == last (the last deleted / pulled min)
+        std::vector<Handle> buckets[BUCKETS];
+        Key last;
+        std::size_t sz;
+
+        static std::uint32_t bucketOf(Key key, Key last) {
+            return key == last ? 0 : 32 - __builtin_clz(key ^ last);
+        }
+
+        void place(Handle h);
+        void unplace(Handle h);
+
+        // refill buckets[0] from the first non-empty bucket (heap must not be empty)
+        void pull();
+    public:
+        RadixHeap() : freeHead(NIL), last(0), sz(0) {}
+
+        bool empty() const { return sz == 0; }
+        std::size_t size() const { return sz; }
+
+        // get-min (key / value): pulls the min into buckets[0], so afterwards the monotone
+        // bound is the current min instead of the last deleted one
+        Key minKey() {
+            if(empty()) throw std::runtime_error("RadixHeap::minKey(): empty heap");
+            if (buckets[0].empty()) pull();
+            return last;
+        }
+
+        const T& getMin() {
+            if(empty()) throw std::runtime_error("RadixHeap::getMin(): empty heap");
+            if (buckets[0].empty()) pull();
+            return items[buckets[0].back()].value;
+        }
+
+        // insert: key must be >= last deleted min; return handle for decreaseKey
+        Handle insert(Key key, const T& value);
+
+        // decrease-key: last deleted min <= newKey <= current key
+        void decreaseKey(Handle handle, Key newKey);
+
+        // delete-min: remove one item with the minimum key and return its value
+        T deleteMin();
+
+        // free all items (monotone bound starts over from 0)
+        void clear();
+    };
+
+    #include "radix_heap.ipp"
+}
+
+#endif
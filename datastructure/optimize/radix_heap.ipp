@@ -0,0 +1,105 @@
+#ifdef __INTELLISENSE__
+#include "radix_heap.hpp"
+#endif
+
+using namespace Opt;
+
+template <typename T>
+void RadixHeap<T>::place(Handle h) {
+    Item &it = items[h];
+    it.bucket = bucketOf(it.key, last);
+    it.pos = static_cast<std::uint32_t>(buckets[it.bucket].size());
+    buckets[it.bucket].push_back(h);
+}
+
+template <typename T>
+void RadixHeap<T>::unplace(Handle h) {
+    std::vector<Handle> &b = buckets[items[h].bucket];
+    Handle moved = b.back();
+
+    b[items[h].pos] = moved;
+    items[moved].pos = items[h].pos;
+    b.pop_back();
+}
+
+template <typename T>
+void RadixHeap<T>::pull() {
+    int i = 1;
+    while (buckets[i].empty()) i++;
+
+    // new last = smallest key in bucket i, then every item of bucket i lands in a lower bucket
+    Key newLast = items[buckets[i][0]].key;
+    for (Handle h : buckets[i]) {
+        if (items[h].key < newLast) newLast = items[h].key;
+    }
+    last = newLast;
+
+    std::vector<Handle> moving;
+    moving.swap(buckets[i]);
+    for (Handle h : moving) place(h);
+
+    // keep the capacity of bucket i for later refills
+    moving.clear();
+    buckets[i].swap(moving);
+}
+
+template <typename T>
+typename RadixHeap<T>::Handle RadixHeap<T>::insert(Key key, const T& value) {
+    if (key < last) throw std::runtime_error("RadixHeap::insert: key below last deleted min (not monotone)");
+
+    Handle h;
+    if (freeHead != NIL) {
+        h = freeHead;
+        freeHead = items[h].pos;
+        items[h].key = key;
+        items[h].value = value;
+    } else {
+        if (items.size() >= NIL) throw std::length_error("RadixHeap: too many items for 32-bit handles");
+        h = static_cast<Handle>(items.size());
+        items.push_back(Item{key, value, 0, 0});
+    }
+
+    place(h);
+    sz++;
+    return h;
+}
+
+template <typename T>
+void RadixHeap<T>::decreaseKey(Handle handle, Key newKey) {
+    Item &it = items[handle];
+    if (newKey > it.key) throw std::runtime_error("RadixHeap::decreaseKey: newKey must be <= current key");
+    if (newKey < last) throw std::runtime_error("RadixHeap::decreaseKey: newKey below last deleted min (not monotone)");
+
+    std::uint32_t target = bucketOf(newKey, last);
+    it.key = newKey;
+    if (target == it.bucket) return;
+
+    unplace(handle);
+    place(handle);
+}
+
+template <typename T>
+T RadixHeap<T>::deleteMin() {
+    if(this->empty()) throw std::runtime_error("RadixHeap::deleteMin(): empty heap");
+
+    if (buckets[0].empty()) pull();
+
+    Handle h = buckets[0].back();
+    buckets[0].pop_back();
+    T result = items[h].value;
+
+    items[h].pos = freeHead;
+    freeHead = h;
+    sz--;
+
+    return result;
+}
+
+template <typename T>
+void RadixHeap<T>::clear() {
+    for (auto &b : buckets) b.clear();
+    items.clear();
+    freeHead = NIL;
+    last = 0;
+    sz = 0;
+}
@@ -0,0 +1,107 @@
+#ifndef RANK_PAIRING_HEAP_HPP
+#define RANK_PAIRING_HEAP_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "memory_pool.hpp"
+
+namespace Opt {
+    // half-tree node: left = first child, right = next sibling (binary tree view);
+    // a root has no right subtree, so its `right` chains the circular root list
+    template<typename T>
+    struct RankNode {
+        T key;
+        RankNode<T> *left;
+        RankNode<T> *right;
+        RankNode<T> *parent; // nullptr for roots
+        int rank;
+
+        template <typename... Args>
+        explicit RankNode(std::in_place_t, Args&&... args)
+            : key(std::forward<Args>(args)...), left(nullptr), right(nullptr), parent(nullptr), rank(0) {}
+    };
+
+    // rank-pairing heap, type 1 (Haeupler, Sen & Tarjan): same handle API as PairingHeap
+    //   insert / meld / decreaseKey O(1) amortized, deleteMin O(log n) amortized
+    // deleteMin links half-trees of equal rank in one pass; decreaseKey cuts the node with its
+    // left subtree and only repairs ranks on the path above it (no cascading cuts)
+    template<typename T>
+    class RankPairingHeap {
+    private:
+        RankNode<T> *minNode; // entry point of the circular root list
+        std::size_t sz;
+
+        MemoryPool<RankNode<T>> pool;
+
+        // deleteMin scratch, kept between calls: at most one half-tree per rank
+        std::vector<RankNode<T>*> bucket;
+
+        static int rankOf(const RankNode<T> *x) { return x ? x->rank : -1; }
+
+        // add the half-tree rooted at x to the root list (and update min)
+        void addRoot(RankNode<T> *x);
+
+        // link two roots of equal rank, return the winner (rank + 1)
+        static RankNode<T> *link(RankNode<T> *x, RankNode<T> *y);
+
+        // decrease-key helper: type-1 rank rule on the path from y up
+        static void repairRanks(RankNode<T> *y);
+
+        void deleteAll();
+    public:
+        RankPairingHeap() : minNode(nullptr), sz(0) {}
+        ~RankPairingHeap() { clear(); }
+
+        bool empty() const { return minNode == nullptr; }
+        std::size_t size() const { return sz; }
+
+        PoolStats poolStats() const { return pool.stats(); }
+
+        const T &getMin() const {
+            if (!minNode) throw std::runtime_error("RankPairingHeap::getMin(): empty heap");
+            return minNode->key;
+        }
+
+        // insert: return handle for decreaseKey
+        RankNode<T> *insert(const T &key) { return emplace(key); }
+        RankNode<T> *insert(T &&key) { return emplace(std::move(key)); }
+
+        template <typename... Args>
+        RankNode<T> *emplace(Args&&... args);
+
+        // meld: consume other (other becomes empty)
+        void meld(RankPairingHeap& other);
+
+        // decrease-key: newKey must be <= node->key
+        void decreaseKey(RankNode<T> *node, T newKey);
+
+        // delete-min: remove min and return its value
+        T deleteMin();
+
+        void clear() {
+            deleteAll();
+            minNode = nullptr;
+            sz = 0;
+        }
+
+        // drop all nodes at once (O(1) when T is trivially destructible, see PairingHeap::reset)
+        void reset() {
+            if constexpr (std::is_trivially_destructible<T>::value) {
+                pool.reset();
+                minNode = nullptr;
+                sz = 0;
+            } else {
+                clear();
+            }
+        }
+    };
+
+    #include "rank_pairing_heap.ipp"
+}
+
+#endif
@@ -0,0 +1,174 @@
+#ifdef __INTELLISENSE__
+#include "rank_pairing_heap.hpp"
+#endif
+
+using namespace Opt;
+
+template <typename T>
+void RankPairingHeap<T>::addRoot(RankNode<T> *x) {
+    x->parent = nullptr;
+    if (!minNode) {
+        x->right = x;
+        minNode = x;
+        return;
+    }
+
+    x->right = minNode->right;
+    minNode->right = x;
+    if (minNode->key > x->key) minNode = x;
+}
+
+template <typename T>
+RankNode<T> *RankPairingHeap<T>::link(RankNode<T> *x, RankNode<T> *y) {
+    if (x->key > y->key) std::swap(x, y);
+
+    // loser y becomes the first child of x, its old siblings hang off y->right
+    y->right = x->left;
+    if (y->right) y->right->parent = y;
+    x->left = y;
+    y->parent = x;
+    x->rank++;
+    return x;
+}
+
+template <typename T>
+template <typename... Args>
+RankNode<T> *RankPairingHeap<T>::emplace(Args&&... args) {
+    RankNode<T> *node = pool.allocate(std::in_place, std::forward<Args>(args)...);
+    addRoot(node);
+    sz++;
+    return node;
+}
+
+template <typename T>
+void RankPairingHeap<T>::meld(RankPairingHeap<T>& other) {
+    if (other.empty()) return;
+
+    if (!minNode) {
+        minNode = other.minNode;
+    } else {
+        // splice the two circular root lists
+        std::swap(minNode->right, other.minNode->right);
+        if (minNode->key > other.minNode->key) minNode = other.minNode;
+    }
+    sz += other.sz;
+
+    // other's nodes now belong to this heap, so this pool takes over their blocks
+    pool.absorb(other.pool);
+
+    other.minNode = nullptr;
+    other.sz = 0;
+}
+
+template <typename T>
+T RankPairingHeap<T>::deleteMin() {
+    if (this->empty()) throw std::runtime_error("RankPairingHeap::deleteMin(): empty heap");
+
+    RankNode<T> *z = minNode;
+    T result = std::move(z->key); // z is freed below, nothing reads its key again
+
+    // one-pass linking: a half-tree meeting another of its rank is linked with it and the
+    // winner goes straight to the new root list; unmatched half-trees wait in `bucket`
+    minNode = nullptr;
+    auto place = [this](RankNode<T> *h) {
+        std::size_t r = (std::size_t)h->rank;
+        if (r >= bucket.size()) bucket.resize(r + 1, nullptr);
+        if (bucket[r]) {
+            addRoot(link(bucket[r], h));
+            bucket[r] = nullptr;
+        } else {
+            bucket[r] = h;
+        }
+    };
+
+    // the right spine of z's left subtree: every node on it becomes a root
+    for (RankNode<T> *x = z->left; x;) {
+        RankNode<T> *next = x->right;
+        x->right = nullptr;
+        x->parent = nullptr;
+        x->rank = rankOf(x->left) + 1;
+        place(x);
+        x = next;
+    }
+
+    // the other old roots
+    for (RankNode<T> *x = z->right; x != z;) {
+        RankNode<T> *next = x->right;
+        place(x);
+        x = next;
+    }
+
+    for (RankNode<T> *&h : bucket) {
+        if (!h) continue;
+        addRoot(h);
+        h = nullptr;
+    }
+
+    pool.deallocate(z);
+    sz--;
+    return result;
+}
+
+template <typename T>
+void RankPairingHeap<T>::repairRanks(RankNode<T> *y) {
+    while (y) {
+        int k;
+        if (!y->parent) {
+            k = rankOf(y->left) + 1;
+        } else {
+            // type 1: equal child ranks -> that rank + 1, otherwise the larger one
+            int a = rankOf(y->left), b = rankOf(y->right);
+            k = (a == b) ? a + 1 : std::max(a, b);
+        }
+        if (k >= y->rank) return;
+        y->rank = k;
+        y = y->parent;
+    }
+}
+
+template <typename T>
+void RankPairingHeap<T>::decreaseKey(RankNode<T> *node, T newKey) {
+    if (newKey > node->key) throw std::runtime_error("RankPairingHeap::decreaseKey: newKey must be <= current key");
+
+    node->key = std::move(newKey);
+
+    RankNode<T> *y = node->parent;
+    if (!y) {
+        if (minNode->key > node->key) minNode = node;
+        return;
+    }
+
+    // detach node with its left subtree, its right subtree takes its place under y
+    RankNode<T> *r = node->right;
+    if (y->left == node) y->left = r;
+    else y->right = r;
+    if (r) r->parent = y;
+
+    node->rank = rankOf(node->left) + 1;
+    addRoot(node);
+    repairRanks(y);
+}
+
+template <typename T>
+void RankPairingHeap<T>::deleteAll() {
+    if (!minNode) return;
+
+    // open the root circle: roots chained through `right` + left/right subtrees form one binary
+    // tree; rotate each left child up into the right chain until the current node has none,
+    // then free it -> O(n), no recursion, no stack (same walk as PairingHeap::deleteAll)
+    RankNode<T> *x = minNode->right;
+    minNode->right = nullptr;
+
+    while (x) {
+        if (x->left) {
+            RankNode<T> *c = x->left;
+            x->left = c->right;
+            c->right = x;
+            x = c;
+        } else {
+            RankNode<T> *next = x->right;
+            pool.deallocate(x);
+            x = next;
+        }
+    }
+}
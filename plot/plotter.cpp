@@ -55,6 +55,29 @@ try:
         plt.plot(df['Density(%)'], df[col_opt], 
                  label='Pairing Heap (Memory Pool)', color='firebrick', marker='*', linewidth=2.5, markersize=10, zorder=10)
 
+    # (F) Pairing Heap Compact (32-bit index links - 紫色菱形)
+    if 'Pairing_Compact(ms)' in df.columns:
+        plt.plot(df['Density(%)'], df['Pairing_Compact(ms)'], 
+                 label='Pairing Heap (Compact Index)', color='purple', marker='D', markersize=5, linewidth=2)
+
+    # (G) Fibonacci Heap (decrease-key O(1) 攤銷 - 棕色方塊)
+    if 'Fibonacci(ms)' in df.columns:
+        plt.plot(df['Density(%)'], df['Fibonacci(ms)'], 
+                 label='Fibonacci Heap', color='saddlebrown', marker='s', markersize=5, linewidth=2)
+
+    # (H) Rank-Pairing Heap (type 1 - 青色五角形)
+    if 'Rank_Pairing(ms)' in df.columns:
+        plt.plot(df['Density(%)'], df['Rank_Pairing(ms)'], 
+                 label='Rank-Pairing Heap', color='teal', marker='p', markersize=6, linewidth=2)
+
+    # (I) 其他變體 (pairing 策略等) - 預設樣式，細線
+    styled = ['Density(%)', 'Linear(ms)', 'Std_PQ(ms)', 'Binary(ms)', 'Pairing_NoPool(ms)', col_opt, 'Pairing_Compact(ms)',
+              'Fibonacci(ms)', 'Rank_Pairing(ms)']
+    for col in df.columns:
+        if col.endswith('(ms)') and col not in styled:
+            plt.plot(df['Density(%)'], df[col], 
+                     label=col.replace('(ms)', ''), linestyle='--', linewidth=1.2, alpha=0.8)
+
     # 4. 精細化軸線設定 (Zoom In)
     ax = plt.gca()
 
@@ -62,8 +85,8 @@ try:
     ax.xaxis.set_major_locator(ticker.MultipleLocator(5))
     
     # --- Y 軸: 自動縮放以觀察 Heap 差異 (忽略 Linear Scan) ---
-    # 找出除了 Linear 和 Density 以外的所有數值
-    cols_to_check = [c for c in df.columns if 'Linear' not in c and 'Density' not in c]
+    # 找出除了 Linear 以外的所有時間 (ms) 欄位
+    cols_to_check = [c for c in df.columns if c.endswith('(ms)') and 'Linear' not in c]
     
     if cols_to_check:
         # 找出這些欄位中的最大值